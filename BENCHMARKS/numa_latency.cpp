@@ -0,0 +1,176 @@
+/**
+ * @file numa_latency.cpp
+ * @brief Latency of queued emissions between two threads pinned on different NUMA nodes.
+ *
+ * The producer runs on a CPU of the first NUMA node and the consumer on a CPU of the last one,
+ * the producer emits a queued signal carrying a 512 bytes payload and waits until the consumer has read it (ping-pong).
+ * The median and 99th percentile of the emission-to-slot latency are printed.
+ *
+ * Build it without and with SISL_NUMA_AWARE to compare (Linux only):
+ *   g++ -std=c++20 -O2 -pthread BENCHMARKS/numa_latency.cpp -o numa_latency_default
+ *   g++ -std=c++20 -O2 -pthread -DSISL_NUMA_AWARE BENCHMARKS/numa_latency.cpp -o numa_latency_numa
+ *
+ * On a single node machine both threads run on that node, so the two builds only measure the local latency.
+ */
+
+#define SISL_IMPLEMENTATION
+#include "../sisl.hpp"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	struct payload
+	{
+		clock_type::time_point sent;
+		std::array<std::uint64_t, 64> data;
+	};
+
+	/**
+	 * @brief Parses a sysfs CPU/node list such as "0-3,8,10-11".
+	 */
+	std::vector<int> parse_list(const std::string& text)
+	{
+		std::vector<int> values;
+		std::stringstream stream(text);
+		std::string range;
+		while (std::getline(stream, range, ','))
+		{
+			if (range.empty() || range == "\n")
+				continue;
+			const auto dash = range.find('-');
+			const int first = std::stoi(range.substr(0, dash));
+			const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+			for (int value = first; value <= last; ++value)
+				values.push_back(value);
+		}
+		return values;
+	}
+
+	std::string read_file(const std::string& path)
+	{
+		std::ifstream file(path);
+		std::string text;
+		std::getline(file, text);
+		return text;
+	}
+
+	/**
+	 * @brief Returns the first CPU of a NUMA node (or -1 if the node has no CPU).
+	 */
+	int first_cpu_of(int node)
+	{
+		const auto cpus = parse_list(read_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+		return cpus.empty() ? -1 : cpus.front();
+	}
+
+	void pin_current_thread(int cpu)
+	{
+		if (cpu < 0)
+			return;
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const int iterations = argc > 1 ? std::atoi(argv[1]) : 100000;
+	if (iterations <= 0)
+	{
+		std::cerr << "usage: " << argv[0] << " [iterations > 0]\n";
+		return 1;
+	}
+
+	auto nodes = parse_list(read_file("/sys/devices/system/node/online"));
+	if (nodes.empty())
+		nodes.push_back(0);
+	const int producer_node = nodes.front();
+	const int consumer_node = nodes.back();
+	const int producer_cpu = first_cpu_of(producer_node);
+	int consumer_cpu = first_cpu_of(consumer_node);
+	if (consumer_node == producer_node)
+	{
+		// single node: still use two different CPUs when there are some
+		const auto cpus = parse_list(read_file("/sys/devices/system/node/node" + std::to_string(consumer_node) + "/cpulist"));
+		consumer_cpu = cpus.size() > 1 ? cpus[1] : consumer_cpu;
+	}
+
+#ifdef SISL_NUMA_AWARE
+	std::cout << "build: SISL_NUMA_AWARE\n";
+#else
+	std::cout << "build: default\n";
+#endif
+	std::cout << "producer: node " << producer_node << ", cpu " << producer_cpu << "\n";
+	std::cout << "consumer: node " << consumer_node << ", cpu " << consumer_cpu << "\n";
+
+	sisl::signal<const payload&> sig;
+	std::vector<std::int64_t> latencies(iterations);
+	std::atomic<int> received{ 0 };
+	std::atomic<bool> ready{ false };
+	std::atomic<bool> stop{ false };
+
+	std::thread consumer([&]
+	{
+		pin_current_thread(consumer_cpu);
+		std::uint64_t checksum = 0;
+		sisl::connect(sig, [&](const payload& p)
+		{
+			const auto now = clock_type::now();
+			for (const auto value : p.data)
+				checksum += value;
+			const int index = received.load(std::memory_order_relaxed);
+			latencies[index] = std::chrono::duration_cast<std::chrono::nanoseconds>(now - p.sent).count();
+			received.store(index + 1, std::memory_order_release);
+		}, std::this_thread::get_id(), sisl::type_connection::queued);
+		ready.store(true, std::memory_order_release);
+		while (!stop.load(std::memory_order_acquire))
+			sisl::poll(std::chrono::milliseconds(10));
+		volatile std::uint64_t sink = checksum;
+		(void)sink;
+	});
+
+	pin_current_thread(producer_cpu);
+	while (!ready.load(std::memory_order_acquire))
+		std::this_thread::yield();
+
+	payload p;
+	for (std::size_t i = 0; i < p.data.size(); ++i)
+		p.data[i] = i;
+	for (int i = 0; i < iterations; ++i)
+	{
+		p.sent = clock_type::now();
+		emit sig(p);
+		while (received.load(std::memory_order_acquire) != i + 1)
+			std::this_thread::yield();
+	}
+
+	stop.store(true, std::memory_order_release);
+	consumer.join();
+
+	std::sort(latencies.begin(), latencies.end());
+	std::cout << "iterations: " << iterations << "\n";
+	std::cout << "median: " << latencies[latencies.size() / 2] << " ns\n";
+	std::cout << "p99: " << latencies[latencies.size() * 99 / 100] << " ns\n";
+#ifdef SISL_NUMA_AWARE
+	std::cout << "unbound chunks: " << sisl::numa_bind_failures() << "\n";
+#endif
+	return 0;
+}
@@ -3,11 +3,30 @@
 
 #define SISL_IMPLEMENTATION
 //#define SISL_USE_LOCK_FREE_RING_QUEUE
+//#define SISL_INSTRUMENTATION
+//#define SISL_TRACING
 #include "../sisl.hpp"
 
 #include <string>
 #include <memory>
 #include <iostream>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <shared_mutex>
+#include <sstream>
+#include <future>
+#include <functional>
+#include <span>
+#include <cstdint>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // __linux__
 
 // --- HELPER CLASSES AND FUNCTIONS FOR TESTS ---
 
@@ -182,6 +201,85 @@ TEST_CASE("SISL Connection and Disconnection Scenarios")
     }
 }
 
+/**
+ * @class OverloadReceiver
+ * @brief Receiver with several slots sharing the same signature.
+ */
+class OverloadReceiver
+{
+public:
+    int m_first = 0;
+    int m_second = 0;
+    virtual ~OverloadReceiver() = default;
+    void first(int) { m_first++; }
+    void second(int) { m_second++; }
+    virtual void virtual_first(int) { m_first++; }
+    virtual void virtual_second(int) { m_second++; }
+};
+
+/**
+ * @class OtherVirtualReceiver
+ * @brief Unrelated receiver whose virtual slot has the same vtable layout as OverloadReceiver.
+ */
+class OtherVirtualReceiver
+{
+public:
+    int m_counter = 0;
+    virtual ~OtherVirtualReceiver() = default;
+    virtual void virtual_first(int) { m_counter++; }
+};
+
+TEST_CASE("Method identity")
+{
+    sisl::signal<int> sig;
+    OverloadReceiver receiver;
+
+    SUBCASE("Disconnect one of two methods with the same signature")
+    {
+        sisl::connect(sig, receiver, &OverloadReceiver::first);
+        sisl::connect(sig, receiver, &OverloadReceiver::second);
+        sisl::disconnect(sig, receiver, &OverloadReceiver::first);
+
+        emit sig(1);
+        CHECK(receiver.m_first == 0);
+        CHECK(receiver.m_second == 1);
+    }
+
+    SUBCASE("Unique connection of two methods with the same signature")
+    {
+        sisl::connect(sig, receiver, &OverloadReceiver::virtual_first, std::thread::id(), sisl::type_connection::unique);
+        sisl::connect(sig, receiver, &OverloadReceiver::virtual_second, std::thread::id(), sisl::type_connection::unique);
+        sisl::connect(sig, receiver, &OverloadReceiver::virtual_first, std::thread::id(), sisl::type_connection::unique);
+
+        emit sig(1);
+        CHECK(receiver.m_first == 1);
+        CHECK(receiver.m_second == 1);
+    }
+
+    SUBCASE("Virtual methods of unrelated classes")
+    {
+        OtherVirtualReceiver other;
+        sisl::connect(sig, receiver, &OverloadReceiver::virtual_first);
+        sisl::connect(sig, other, &OtherVirtualReceiver::virtual_first);
+        sisl::disconnect(sig, &OtherVirtualReceiver::virtual_first);
+
+        emit sig(1);
+        CHECK(receiver.m_first == 1);
+        CHECK(other.m_counter == 0);
+    }
+
+    SUBCASE("Unique connection of a C function")
+    {
+        sisl::signal<> empty_sig;
+        standalone_counter = 0;
+        sisl::connect(empty_sig, &standalone_function_slot, std::thread::id(), sisl::type_connection::unique);
+        sisl::connect(empty_sig, &standalone_function_slot, std::thread::id(), sisl::type_connection::unique);
+
+        emit empty_sig();
+        CHECK(standalone_counter == 1);
+    }
+}
+
 TEST_CASE("Advanced Connection Features")
 {
     Emitter emitter;
@@ -211,6 +309,36 @@ TEST_CASE("Advanced Connection Features")
         CHECK(receiver.m_counter == 1); // Slot is called only once
     }
 
+    SUBCASE("Unique connection returns the existing connection")
+    {
+        receiver.reset();
+        std::vector<Receiver> receivers(1000);
+        for (auto& r : receivers)
+            sisl::connect(emitter, &Emitter::int_signal, r, &Receiver::receive_int, std::thread::id(), sisl::type_connection::unique);
+
+        sisl::connection first = sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::unique);
+        sisl::connection second = sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::unique);
+        for (auto& r : receivers)
+            sisl::connect(emitter, &Emitter::int_signal, r, &Receiver::receive_int, std::thread::id(), sisl::type_connection::unique);
+
+        emit emitter.int_signal(1);
+        CHECK(receiver.m_counter == 1);
+        CHECK(receivers.front().m_counter == 1);
+        CHECK(receivers.back().m_counter == 1);
+
+        // Both handles refer to the same slot
+        second.disconnect();
+        CHECK_FALSE(first.connected());
+
+        // Once disconnected, the slot can be connected again
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::unique);
+        sisl::disconnect(emitter, &Emitter::int_signal, receivers[10], &Receiver::receive_int);
+        emit emitter.int_signal(2);
+        CHECK(receiver.m_counter == 2);
+        CHECK(receivers[10].m_counter == 1);
+        CHECK(receivers[11].m_counter == 2);
+    }
+
     // ------------------------------------------------------------------
     // SCENARIO 6: Single-shot connection
     // ------------------------------------------------------------------
@@ -231,6 +359,137 @@ TEST_CASE("Advanced Connection Features")
     }
 }
 
+TEST_CASE("Connection handles")
+{
+    Emitter emitter;
+    Receiver receiver;
+
+    SUBCASE("Disconnect through the connection handle")
+    {
+        Receiver receiver2;
+        sisl::connection connection = sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int);
+        sisl::connect(emitter, &Emitter::int_signal, receiver2, &Receiver::receive_int);
+        CHECK(connection.connected());
+
+        emit emitter.int_signal(1);
+        connection.disconnect();
+        CHECK_FALSE(connection.connected());
+        emit emitter.int_signal(2);
+
+        CHECK(receiver.m_counter == 1);
+        CHECK(receiver2.m_counter == 2);
+        REQUIRE_NOTHROW(connection.disconnect()); // Already disconnected
+    }
+
+    SUBCASE("Scoped connection disconnects on destruction")
+    {
+        {
+            sisl::scoped_connection connection = sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int);
+            emit emitter.int_signal(1);
+        }
+        emit emitter.int_signal(2);
+        CHECK(receiver.m_counter == 1);
+
+        sisl::connection released;
+        {
+            sisl::scoped_connection connection = sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int);
+            released = connection.release();
+        }
+        emit emitter.int_signal(3);
+        CHECK(receiver.m_counter == 2);
+        CHECK(released.connected());
+    }
+
+    SUBCASE("Handle outliving its signal")
+    {
+        sisl::connection connection;
+        {
+            sisl::signal<int> sig;
+            connection = sisl::connect(sig, receiver, &Receiver::receive_int);
+            CHECK(connection.connected());
+        }
+        CHECK_FALSE(connection.connected());
+        REQUIRE_NOTHROW(connection.disconnect());
+    }
+
+    SUBCASE("Emission order is kept after many disconnections")
+    {
+        sisl::signal<> sig;
+        std::vector<int> order;
+        std::vector<sisl::connection> connections;
+        for (int i = 0; i < 100; ++i)
+            connections.push_back(sisl::connect(sig, [&order, i]() { order.push_back(i); }));
+        for (int i = 0; i < 100; ++i)
+        {
+            if (i % 3 != 0)
+                connections[i].disconnect();
+        }
+
+        emit sig();
+        REQUIRE(order.size() == 34);
+        for (std::size_t i = 0; i < order.size(); ++i)
+            CHECK(order[i] == static_cast<int>(i * 3));
+    }
+}
+
+TEST_CASE("Unconnected signals")
+{
+    SUBCASE("Operations on a signal that was never connected")
+    {
+        sisl::signal<int> sig;
+        Receiver receiver;
+        REQUIRE_NOTHROW(sig(1));
+        REQUIRE_NOTHROW(sisl::disconnect(sig, receiver, &Receiver::receive_int));
+        REQUIRE_NOTHROW(sisl::disconnect(sig, receiver));
+        REQUIRE_NOTHROW(sisl::disconnect(sig, &Receiver::receive_int));
+        REQUIRE_NOTHROW(sisl::disconnect_all(sig));
+
+        sisl::connect(sig, receiver, &Receiver::receive_int);
+        emit sig(1);
+        CHECK(receiver.m_counter == 1);
+    }
+
+    SUBCASE("First connections from several threads")
+    {
+        sisl::signal<> sig;
+        std::atomic<int> counter = 0;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back([&sig, &counter]() { sisl::connect(sig, [&counter]() { counter++; }); });
+        for (auto& thread : threads)
+            thread.join();
+        emit sig();
+        CHECK(counter == 4); // Only one slots list was installed
+    }
+
+    SUBCASE("An unconnected signal is one pointer")
+    {
+        CHECK(sizeof(sisl::signal<int>) == sizeof(void*));
+        CHECK(sizeof(Emitter) == 3 * sizeof(void*));
+    }
+
+    SUBCASE("Mutex chosen by policy")
+    {
+        sisl::basic_signal<sisl::signal_policy<SISL_DELEGATE_STORAGE_SIZE, sisl::spin_mutex>, int> spin_sig;
+        sisl::basic_signal<sisl::signal_policy<SISL_DELEGATE_STORAGE_SIZE, std::mutex>, int> mutex_sig;
+        CHECK(sizeof(spin_sig) == sizeof(void*));
+
+        Receiver receiver;
+        sisl::connection connection = sisl::connect(spin_sig, receiver, &Receiver::receive_int);
+        sisl::connect(mutex_sig, receiver, &Receiver::receive_int);
+        emit spin_sig(1);
+        emit mutex_sig(2);
+        CHECK(receiver.m_counter == 2);
+        CHECK(receiver.m_value == 2);
+
+        connection.disconnect();
+        sisl::disconnect(mutex_sig, receiver, &Receiver::receive_int);
+        emit spin_sig(3);
+        emit mutex_sig(4);
+        CHECK(receiver.m_counter == 2);
+    }
+}
+
 TEST_CASE("Other Callable Connections")
 {
 
@@ -270,6 +529,41 @@ TEST_CASE("Other Callable Connections")
     }
 }
 
+TEST_CASE("Delegate storage")
+{
+    SUBCASE("Callable bigger than the inline storage")
+    {
+        sisl::signal<int> sig;
+        std::array<int, 64> big_capture{};
+        big_capture[63] = 7;
+        int result = 0;
+
+        sisl::connect(sig, [big_capture, &result](int value) { result = value + big_capture[63]; });
+
+        emit sig(35);
+        CHECK(result == 42);
+        sisl::disconnect_all(sig);
+        emit sig(0);
+        CHECK(result == 42);
+    }
+
+    SUBCASE("Signal with a custom storage size")
+    {
+        sisl::sized_signal<16, int> sig;
+        Receiver receiver;
+        int small_counter = 0;
+        std::array<char, 48> medium_capture{};
+
+        sisl::connect(sig, receiver, &Receiver::receive_int);  // Method slot doesn't fit in 16 bytes: pooled heap block
+        sisl::connect(sig, [&small_counter](int) { small_counter++; }); // Fits inline
+        sisl::connect(sig, [medium_capture, &small_counter](int) { small_counter += static_cast<int>(medium_capture.size()); });
+
+        emit sig(5);
+        CHECK(receiver.m_value == 5);
+        CHECK(small_counter == 49);
+    }
+}
+
 TEST_CASE("Automatic Disconnection with Shared Objects")
 {
     SUBCASE("Auto-disconnect for shared_ptr managed objects")
@@ -317,6 +611,1488 @@ TEST_CASE("Automatic Disconnection with Shared Objects")
     }
 }
 
+/**
+ * @class TrackableReceiver
+ * @brief A receiver whose slots are disconnected on destruction.
+ */
+class TrackableReceiver : public sisl::trackable
+{
+public:
+    int m_counter = 0;
+    void receive_int(int) { m_counter++; }
+    void receive_string(const std::string&) { m_counter++; }
+};
+
+/**
+ * @class SharedTrackableReceiver
+ * @brief A trackable receiver also managed by shared_ptr.
+ */
+class SharedTrackableReceiver : public sisl::trackable, public std::enable_shared_from_this<SharedTrackableReceiver>
+{
+public:
+    int m_counter = 0;
+    long m_use_count_in_slot = 0;
+    void receive()
+    {
+        m_counter++;
+        m_use_count_in_slot = weak_from_this().use_count();
+    }
+};
+
+/**
+ * @class GuardedReceiver
+ * @brief A trackable receiver that detects calls after (or during) its destruction.
+ */
+class GuardedReceiver : public sisl::trackable
+{
+public:
+    static constexpr int alive_magic = 0x5151;
+    explicit GuardedReceiver(std::atomic<int>& invalid_calls) : m_invalid_calls(invalid_calls) {}
+    ~GuardedReceiver()
+    {
+        disconnect_tracked_slots();
+        m_magic = 0;
+    }
+    void receive(int)
+    {
+        if (m_magic != alive_magic)
+            m_invalid_calls++;
+    }
+private:
+    volatile int m_magic = alive_magic;
+    std::atomic<int>& m_invalid_calls;
+};
+
+TEST_CASE("Trackable receivers")
+{
+    Emitter emitter;
+
+    SUBCASE("Slots are disconnected when the receiver is destroyed")
+    {
+        Receiver other;
+        sisl::connection int_connection;
+        sisl::connection string_connection;
+        {
+            TrackableReceiver receiver;
+            int_connection = sisl::connect(emitter, &Emitter::int_signal, receiver, &TrackableReceiver::receive_int);
+            string_connection = sisl::connect(emitter, &Emitter::string_signal, receiver, &TrackableReceiver::receive_string);
+            sisl::connect(emitter, &Emitter::int_signal, other, &Receiver::receive_int);
+            emit emitter.int_signal(1);
+            CHECK(receiver.m_counter == 1);
+        }
+        CHECK_FALSE(int_connection.connected());
+        CHECK_FALSE(string_connection.connected());
+
+        // No dangling call
+        emit emitter.int_signal(2);
+        emit emitter.string_signal("dead");
+        CHECK(other.m_counter == 2);
+    }
+
+    SUBCASE("Pending queued calls are dropped")
+    {
+        Receiver other;
+        auto receiver = std::make_unique<TrackableReceiver>();
+        sisl::connect(emitter, &Emitter::int_signal, *receiver, &TrackableReceiver::receive_int, std::thread::id(), sisl::type_connection::queued);
+        sisl::connect(emitter, &Emitter::int_signal, other, &Receiver::receive_int, std::thread::id(), sisl::type_connection::queued);
+
+        emit emitter.int_signal(1); // Queued for the current thread
+        receiver.reset();
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(other.m_counter == 1);
+    }
+
+    SUBCASE("Shared trackable receivers are disconnected without waiting for the next emission")
+    {
+        sisl::signal<> sig;
+        auto receiver = std::make_shared<SharedTrackableReceiver>();
+        sisl::connection connection = sisl::connect(sig, *receiver, &SharedTrackableReceiver::receive);
+        emit sig();
+        CHECK(receiver->m_counter == 1);
+        CHECK(receiver->m_use_count_in_slot == 1); // The slot doesn't lock a weak_ptr to call the receiver
+        receiver.reset();
+        CHECK_FALSE(connection.connected());
+    }
+
+    SUBCASE("Receiver destroyed while other threads are emitting")
+    {
+        sisl::signal<int> sig;
+        std::atomic<int> invalid_calls = 0;
+        std::atomic_bool stop = false;
+        std::vector<std::thread> emitters;
+        for (int round = 0; round < 20; ++round)
+        {
+            auto receiver = std::make_unique<GuardedReceiver>(invalid_calls);
+            sisl::connect(sig, *receiver, &GuardedReceiver::receive);
+            if (emitters.empty())
+            {
+                for (int i = 0; i < 4; ++i)
+                    emitters.emplace_back([&sig, &stop]() { while (!stop) emit sig(1); });
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            receiver.reset();
+        }
+        stop = true;
+        for (auto& emitter_thread : emitters)
+            emitter_thread.join();
+        CHECK(invalid_calls == 0);
+    }
+
+    SUBCASE("Receivers connecting and disconnecting repeatedly")
+    {
+        TrackableReceiver receiver;
+        for (int i = 0; i < 1000; ++i)
+            sisl::connect(emitter, &Emitter::int_signal, receiver, &TrackableReceiver::receive_int).disconnect();
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &TrackableReceiver::receive_int);
+        emit emitter.int_signal(1);
+        CHECK(receiver.m_counter == 1);
+    }
+}
+
+/**
+ * @class StressReceiver
+ * @brief A receiver whose slots can be invoked from several threads at once.
+ */
+class StressReceiver
+{
+public:
+    std::atomic<int> m_counter = 0;
+    void receive(int value) { m_counter += value; }
+    void receive_other(int value) { m_counter += value; }
+};
+
+TEST_CASE("Concurrent connect, disconnect and emit")
+{
+    // Meant to be run under ThreadSanitizer: every operation on the signal runs concurrently with the others.
+    constexpr int nb_emitters = 2;
+    constexpr int nb_emits = 2000;
+    constexpr int nb_rounds = 300;
+
+    sisl::signal<int> sig;
+    StressReceiver anchor;
+    std::array<StressReceiver, 8> receivers;
+    std::atomic_bool stop = false;
+
+    // Stays connected during the whole test: every emission must reach it exactly once
+    sisl::connect(sig, anchor, &StressReceiver::receive);
+
+    // Connects and disconnects from inside an emission
+    sisl::connect(sig, [&sig, &receivers](int)
+    {
+        sisl::connect(sig, receivers[0], &StressReceiver::receive_other).disconnect();
+    });
+
+    std::thread poller([&stop]()
+    {
+        while (!stop)
+            sisl::poll(std::chrono::milliseconds(1));
+    });
+    const std::thread::id poller_id = poller.get_id();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nb_emitters; ++i)
+    {
+        threads.emplace_back([&sig]()
+        {
+            for (int j = 0; j < nb_emits; ++j)
+            {
+                // The bounded ring queue may be full, the anchor is invoked before the queued slots anyway
+                try { emit sig(1); }
+                catch (const sisl::queue_full&) {}
+            }
+        });
+    }
+    threads.emplace_back([&sig, &receivers]()
+    {
+        for (int round = 0; round < nb_rounds; ++round)
+        {
+            auto& receiver = receivers[round % receivers.size()];
+            sisl::connection connection = sisl::connect(sig, receiver, &StressReceiver::receive);
+            sisl::connect(sig, receiver, &StressReceiver::receive_other, std::thread::id(), sisl::type_connection::unique);
+            {
+                sisl::scoped_connection scoped = sisl::connect(sig, [](int) {});
+            }
+            connection.disconnect();
+            sisl::disconnect(sig, receiver, &StressReceiver::receive_other);
+        }
+    });
+    threads.emplace_back([&sig, &receivers, poller_id]()
+    {
+        for (int round = 0; round < nb_rounds; ++round)
+        {
+            auto& receiver = receivers[(round + 4) % receivers.size()];
+            sisl::connect(sig, receiver, &StressReceiver::receive, poller_id, sisl::type_connection::queued);
+            sisl::connect(sig, receiver, &StressReceiver::receive_other, std::thread::id(), sisl::type_connection::single_shot);
+            sisl::disconnect(sig, &receiver);
+        }
+    });
+    threads.emplace_back([&sig]()
+    {
+        for (int round = 0; round < nb_rounds; ++round)
+        {
+            // Owned by the slot: an emitter may still be invoking it after the disconnection
+            auto sp_local_sig = std::make_shared<sisl::signal<int>>();
+            auto sp_local_receiver = std::make_shared<StressReceiver>();
+            sisl::connect(*sp_local_sig, *sp_local_receiver, &StressReceiver::receive);
+            sisl::connect(sig, [sp_local_sig, sp_local_receiver](int value) { (*sp_local_sig)(value); }).disconnect();
+        }
+    });
+
+    for (auto& thread : threads)
+        thread.join();
+    stop = true;
+    poller.join();
+
+    CHECK(anchor.m_counter == nb_emitters * nb_emits);
+}
+
+TEST_CASE("Event loops")
+{
+    sisl::signal<int> sig;
+    Receiver receiver;
+
+    SUBCASE("Queued calls are invoked by the thread polling the loop")
+    {
+        sisl::event_loop loop;
+        sisl::connect(sig, receiver, &Receiver::receive_int, loop, sisl::type_connection::queued);
+        emit sig(1);
+        emit sig(2);
+        CHECK(receiver.m_counter == 0);
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(receiver.m_counter == 2);
+        CHECK(receiver.m_value == 2);
+        CHECK(loop.poll() == sisl::polling_result::timeout);
+    }
+
+    SUBCASE("A loop can be polled by another thread")
+    {
+        sisl::event_loop loop;
+        std::vector<std::thread::id> invoking_threads;
+        sisl::connect(sig, [&invoking_threads](int) { invoking_threads.push_back(std::this_thread::get_id()); }, loop);
+
+        emit sig(1);
+        std::thread first([&loop]() { loop.poll(); });
+        const std::thread::id first_id = first.get_id();
+        first.join();
+
+        emit sig(2);
+        std::thread second([&loop]() { loop.poll(); });
+        const std::thread::id second_id = second.get_id();
+        second.join();
+
+        REQUIRE(invoking_threads.size() == 2);
+        CHECK(invoking_threads[0] == first_id);
+        CHECK(invoking_threads[1] == second_id);
+    }
+
+    SUBCASE("Automatic connections are direct inside their loop")
+    {
+        sisl::event_loop loop;
+        sisl::signal<> inner_sig;
+        int inner_counter = 0;
+        sisl::connect(inner_sig, [&inner_counter]() { inner_counter++; }, loop);
+        sisl::connect(sig, [&inner_sig, &inner_counter](int)
+        {
+            emit inner_sig();
+            CHECK(inner_counter == 1);
+        }, loop);
+
+        emit sig(1); // Not in the loop: queued
+        emit inner_sig();
+        CHECK(inner_counter == 0);
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(inner_counter == 2);
+    }
+
+    SUBCASE("Blocking queued call to a loop polled by another thread")
+    {
+        sisl::event_loop loop;
+        std::thread worker([&loop]() { while (loop.poll(sisl::blocking_polling) != sisl::polling_result::terminated) {} });
+        sisl::connect(sig, receiver, &Receiver::receive_int, loop, sisl::type_connection::blocking_queued);
+        emit sig(3);
+        CHECK(receiver.m_value == 3);
+        loop.terminate();
+        worker.join();
+    }
+
+    SUBCASE("Calls to a terminated or destroyed loop are dropped")
+    {
+        auto loop = std::make_unique<sisl::event_loop>();
+        sisl::connect(sig, receiver, &Receiver::receive_int, *loop, sisl::type_connection::queued);
+        emit sig(1); // Pending when the loop is destroyed
+        loop.reset();
+        emit sig(2);
+        CHECK(receiver.m_counter == 0);
+
+        sisl::event_loop terminated_loop;
+        sisl::connect(sig, receiver, &Receiver::receive_int, terminated_loop, sisl::type_connection::blocking_queued);
+        terminated_loop.terminate();
+        REQUIRE_NOTHROW(sig(3)); // Does not wait for a call that will never be invoked
+        CHECK(terminated_loop.poll() == sisl::polling_result::terminated);
+        CHECK(receiver.m_counter == 0);
+    }
+
+    SUBCASE("A loop destroyed while producers emit releases their calls")
+    {
+        auto loop = std::make_unique<sisl::event_loop>();
+        sisl::signal<std::shared_ptr<int>> payload_sig;
+        std::atomic<int> nb_invoked = 0;
+        sisl::connect(payload_sig, [&nb_invoked](std::shared_ptr<int>) { nb_invoked++; }, *loop, sisl::type_connection::queued);
+        sisl::connect(payload_sig, [&nb_invoked](std::shared_ptr<int>) { nb_invoked++; }, *loop, sisl::type_connection::blocking_queued);
+        std::thread worker([&loop]() { while (loop->poll(sisl::blocking_polling) != sisl::polling_result::terminated) {} });
+
+        const auto sp_payload = std::make_shared<int>(42);
+        std::atomic_bool stop = false;
+        std::vector<std::thread> producers;
+        for (int i = 0; i < 4; ++i)
+        {
+            producers.emplace_back([&payload_sig, &sp_payload, &stop]()
+            {
+                while (!stop)
+                    emit payload_sig(sp_payload);
+            });
+        }
+        while (nb_invoked < 100)
+            std::this_thread::yield();
+        loop->terminate();
+        worker.join();
+        loop.reset(); // The producers are still emitting: the blocking ones must not wait forever
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stop = true;
+        for (auto& producer : producers)
+            producer.join();
+        CHECK(sp_payload.use_count() == 1); // No call (and slot) is left in a queue
+    }
+
+    SUBCASE("A loop is polled by one thread at a time")
+    {
+        sisl::event_loop loop;
+        bool has_thrown = false;
+        sisl::connect(sig, [&loop, &has_thrown](int)
+        {
+            std::thread other([&loop, &has_thrown]()
+            {
+                try { loop.poll(); }
+                catch (const sisl::invalid_concurrent_polling&) { has_thrown = true; }
+            });
+            other.join();
+        }, loop);
+        emit sig(1);
+        loop.poll();
+        CHECK(has_thrown);
+    }
+}
+
+TEST_CASE("Pooled connections")
+{
+    sisl::signal<int> sig;
+
+    SUBCASE("A pooled call emitted by a worker runs on another worker")
+    {
+        std::atomic<int> counter = 0;
+        std::atomic<std::thread::id> invoking_thread;
+        sisl::connect(sig, [&counter, &invoking_thread](int)
+        {
+            invoking_thread = std::this_thread::get_id();
+            counter++;
+        }, std::thread::id(), sisl::type_connection::pooled);
+        sisl::poll(); // The current thread becomes a worker of the pool
+        emit sig(1);
+        CHECK(counter == 0);
+        CHECK(sisl::poll() == sisl::polling_result::timeout); // Not even by a later poll of the emitter
+        CHECK(counter == 0);
+
+        std::thread::id worker_id;
+        std::thread worker([&worker_id]()
+        {
+            worker_id = std::this_thread::get_id();
+            CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        });
+        worker.join();
+        CHECK(counter == 1);
+        CHECK(invoking_thread.load() == worker_id);
+    }
+
+    SUBCASE("Event loops take the pooled calls")
+    {
+        int counter = 0;
+        sisl::connect(sig, [&counter](int) { counter++; }, std::thread::id(), sisl::type_connection::pooled);
+        sisl::event_loop loop;
+        std::thread([&sig]() { emit sig(1); }).join(); // Emitted by a thread that is not a worker
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(counter == 1);
+    }
+
+    SUBCASE("Any polling thread invokes the pooled calls")
+    {
+        constexpr int nb_workers = 4;
+        constexpr int nb_emits = 1000;
+        std::atomic<int> counter = 0;
+        std::atomic<int> calls_in_emitter = 0;
+        std::atomic<std::thread::id> emitter_id;
+        sisl::connect(sig, [&counter, &calls_in_emitter, &emitter_id](int)
+        {
+            if (std::this_thread::get_id() == emitter_id.load())
+                calls_in_emitter++;
+            counter++;
+        }, std::thread::id(), sisl::type_connection::pooled);
+
+        std::vector<std::unique_ptr<sisl::jthread>> workers;
+        for (int i = 0; i < nb_workers; ++i)
+        {
+            workers.push_back(std::make_unique<sisl::jthread>([](std::stop_token token)
+            {
+                while (!token.stop_requested() && sisl::poll(sisl::blocking_polling) != sisl::polling_result::terminated)
+                {
+                }
+            }));
+        }
+        std::thread emitter([&sig, &emitter_id]()
+        {
+            emitter_id = std::this_thread::get_id();
+            for (int i = 0; i < nb_emits; ++i)
+                emit sig(i);
+        });
+        emitter.join();
+        for (int i = 0; i < 10000 && counter != nb_emits; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        workers.clear();
+
+        CHECK(counter == nb_emits);
+        CHECK(calls_in_emitter == 0);
+#ifdef SISL_INSTRUMENTATION
+        CHECK(sisl::get_statistics().pooled_depth == 0); // The thefts never decrement the pending counter before its increment
+#endif // SISL_INSTRUMENTATION
+    }
+}
+
+TEST_CASE("Idle connections")
+{
+    sisl::signal<int> sig;
+    std::vector<std::string> calls;
+
+    SUBCASE("Idle calls are invoked when no other call is pending")
+    {
+        sisl::event_loop loop;
+        sisl::connect(sig, [&calls](int value) { calls.push_back("idle " + std::to_string(value)); }, loop, sisl::type_connection::idle);
+        sisl::connect(sig, [&calls](int value) { calls.push_back("queued " + std::to_string(value)); }, loop, sisl::type_connection::queued);
+        emit sig(1);
+        emit sig(2);
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(calls == std::vector<std::string>{ "queued 1", "queued 2", "idle 1", "idle 2" });
+        CHECK(loop.poll() == sisl::polling_result::timeout);
+    }
+
+    SUBCASE("Calls queued by an idle slot run before the next idle call")
+    {
+        sisl::event_loop loop;
+        sisl::signal<int> urgent;
+        sisl::connect(urgent, [&calls](int value) { calls.push_back("urgent " + std::to_string(value)); }, loop, sisl::type_connection::queued);
+        sisl::connect(sig, [&calls, &urgent](int value)
+        {
+            calls.push_back("idle " + std::to_string(value));
+            emit urgent(value);
+        }, loop, sisl::type_connection::idle);
+        emit sig(1);
+        emit sig(2);
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(calls == std::vector<std::string>{ "idle 1", "urgent 1", "idle 2", "urgent 2" });
+    }
+
+    SUBCASE("Idle calls to the current thread, and to a destroyed loop")
+    {
+        sisl::connect(sig, [&calls](int value) { calls.push_back("idle " + std::to_string(value)); }, std::this_thread::get_id(), sisl::type_connection::idle);
+        emit sig(1);
+        CHECK(calls.empty());
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(calls == std::vector<std::string>{ "idle 1" });
+
+        Receiver receiver;
+        auto loop = std::make_unique<sisl::event_loop>();
+        sisl::connect(sig, receiver, &Receiver::receive_int, *loop, sisl::type_connection::idle);
+        emit sig(2); // Pending when the loop is destroyed
+        loop.reset();
+        CHECK(receiver.m_counter == 0);
+        sisl::poll();
+    }
+}
+
+TEST_CASE("Timers")
+{
+    using namespace std::chrono_literals;
+    sisl::signal<int> sig;
+    std::vector<int> values;
+    sisl::connect(sig, [&values](int value) { values.push_back(value); });
+
+    SUBCASE("Delayed emissions are fired by poll() in deadline order")
+    {
+        sisl::timer late = sig.emit_after(20ms, 2);
+        sisl::timer early = sig.emit_after(5ms, 1);
+        CHECK(sisl::poll() == sisl::polling_result::timeout);
+        CHECK(values.empty());
+        CHECK(late.active());
+
+        const auto start = std::chrono::steady_clock::now();
+        while (values.size() < 2 && std::chrono::steady_clock::now() - start < 5s)
+            sisl::poll(sisl::blocking_polling); // Wakes up at the deadlines without any emission
+        CHECK(values == std::vector<int>{ 1, 2 });
+        CHECK(std::chrono::steady_clock::now() - start >= 15ms);
+        CHECK_FALSE(early.active());
+        CHECK_FALSE(late.active());
+    }
+
+    SUBCASE("A poll with a timeout returns at the deadline")
+    {
+        sig.emit_after(5ms, 1);
+        const auto start = std::chrono::steady_clock::now();
+        CHECK(sisl::poll(10s) == sisl::polling_result::slots_invoked);
+        CHECK(std::chrono::steady_clock::now() - start < 5s);
+        CHECK(values == std::vector<int>{ 1 });
+    }
+
+    SUBCASE("Periodic emissions until cancelled")
+    {
+        sisl::timer periodic = sig.emit_every(2ms, 7);
+        while (values.size() < 3)
+            sisl::poll(sisl::blocking_polling);
+        periodic.cancel();
+        CHECK_FALSE(periodic.active());
+        CHECK(sisl::poll(10ms) == sisl::polling_result::timeout);
+        CHECK(values == std::vector<int>{ 7, 7, 7 });
+        CHECK_THROWS_AS(sig.emit_every(0ms, 1), sisl::invalid_timer_period);
+    }
+
+    SUBCASE("A destroyed signal stops its timers")
+    {
+        auto sp_sig = std::make_unique<sisl::signal<int>>();
+        sisl::connect(*sp_sig, [&values](int value) { values.push_back(value); });
+        sisl::timer periodic = sp_sig->emit_every(1ms, 3);
+        sp_sig.reset();
+        CHECK_FALSE(periodic.active());
+        CHECK(sisl::poll(5ms) == sisl::polling_result::timeout);
+        CHECK(values.empty());
+    }
+
+    SUBCASE("Timers scheduled from a loop are fired by the loop")
+    {
+        sisl::event_loop loop;
+        sisl::signal<> start;
+        sisl::connect(start, [&sig]() { sig.emit_after(1ms, 5); }, loop, sisl::type_connection::queued);
+        emit start();
+        CHECK(loop.poll() == sisl::polling_result::slots_invoked);
+        CHECK(loop.poll(5s) == sisl::polling_result::slots_invoked);
+        CHECK(values == std::vector<int>{ 5 });
+    }
+
+    SUBCASE("Move-only arguments are moved to the slot")
+    {
+        sisl::signal<std::unique_ptr<int>> sig_move;
+        int received = 0;
+        sisl::connect(sig_move, [&received](std::unique_ptr<int>&& p) { received = *p; });
+        sig_move.emit_after(0ms, std::make_unique<int>(42));
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(received == 42);
+    }
+}
+
+#ifdef __linux__
+static bool is_readable(int fd)
+{
+    pollfd descriptor{ fd, POLLIN, 0 };
+    return ::poll(&descriptor, 1, 0) == 1 && (descriptor.revents & POLLIN);
+}
+
+TEST_CASE("Event file descriptors")
+{
+    sisl::signal<int> sig;
+
+    SUBCASE("The eventfd of a thread is readable while calls are pending")
+    {
+        int received = 0;
+        sisl::connect(sig, [&received](int value) { received = value; }, std::this_thread::get_id(), sisl::type_connection::queued);
+        const int fd = sisl::event_fd();
+        CHECK(fd == sisl::event_fd());
+        CHECK_FALSE(is_readable(fd));
+        std::thread([&sig]() { emit sig(1); emit sig(2); }).join();
+        CHECK(is_readable(fd));
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(received == 2);
+        CHECK_FALSE(is_readable(fd));
+    }
+
+    SUBCASE("A single epoll_wait() for the sockets and the signals")
+    {
+        int sockets[2];
+        REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+        sisl::event_loop loop;
+        std::vector<int> received;
+        sisl::connect(sig, [&received](int value) { received.push_back(value); }, loop, sisl::type_connection::queued);
+
+        const int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        REQUIRE(epoll >= 0);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = loop.event_fd();
+        REQUIRE(::epoll_ctl(epoll, EPOLL_CTL_ADD, event.data.fd, &event) == 0);
+        event.data.fd = sockets[0];
+        REQUIRE(::epoll_ctl(epoll, EPOLL_CTL_ADD, event.data.fd, &event) == 0);
+
+        std::thread producer([&sig, &sockets]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                emit sig(i);
+                if (i % 10 == 0)
+                {
+                    const char byte = 'x';
+                    CHECK(::write(sockets[1], &byte, 1) == 1);
+                }
+            }
+        });
+        int nb_bytes = 0;
+        for (int i = 0; i < 1000 && (received.size() < 100 || nb_bytes < 10); ++i)
+        {
+            epoll_event events[2];
+            const int nb_events = ::epoll_wait(epoll, events, 2, 1000);
+            for (int e = 0; e < nb_events; ++e)
+            {
+                if (events[e].data.fd == sockets[0])
+                {
+                    char bytes[16];
+                    nb_bytes += static_cast<int>(::read(sockets[0], bytes, sizeof(bytes)));
+                }
+                else
+                {
+                    loop.poll();
+                }
+            }
+        }
+        producer.join();
+        CHECK(received.size() == 100);
+        CHECK(nb_bytes == 10);
+        CHECK_FALSE(is_readable(loop.event_fd()));
+
+        loop.terminate(); // Wakes up the epoll_wait()
+        epoll_event events[2];
+        CHECK(::epoll_wait(epoll, events, 2, 1000) == 1);
+        CHECK(loop.poll() == sisl::polling_result::terminated);
+        ::close(epoll);
+        ::close(sockets[0]);
+        ::close(sockets[1]);
+    }
+
+    SUBCASE("An epoll_wait() bounded by the next timer fires the timers")
+    {
+        using namespace std::chrono_literals;
+        int received = 0;
+        sisl::connect(sig, [&received](int value) { received = value; });
+        const int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        REQUIRE(epoll >= 0);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = sisl::event_fd();
+        REQUIRE(::epoll_ctl(epoll, EPOLL_CTL_ADD, event.data.fd, &event) == 0);
+
+        sisl::poll();
+        CHECK(sisl::next_timer_delay() == sisl::blocking_polling);
+        sig.emit_after(5ms, 4);
+        const auto delay = sisl::next_timer_delay();
+        CHECK(delay > 0ms);
+        CHECK(delay <= 5ms);
+        for (int i = 0; i < 100 && received == 0; ++i)
+        {
+            const auto next = sisl::next_timer_delay();
+            epoll_event events[1];
+            ::epoll_wait(epoll, events, 1, next == sisl::blocking_polling ? 1000 : static_cast<int>(next.count()));
+            sisl::poll();
+        }
+        CHECK(received == 4);
+        CHECK(sisl::next_timer_delay() == sisl::blocking_polling);
+        ::close(epoll);
+    }
+
+    SUBCASE("A pooled call makes the eventfd of a worker waiting in epoll readable")
+    {
+        int received = 0;
+        sisl::connect(sig, [&received](int value) { received = value; }, std::thread::id(), sisl::type_connection::pooled);
+        sisl::poll(); // The current thread is a worker
+        const int fd = sisl::event_fd();
+        CHECK_FALSE(is_readable(fd));
+        std::thread([&sig]() { emit sig(3); }).join(); // No worker sleeps in poll()
+        CHECK(is_readable(fd));
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(received == 3);
+        CHECK_FALSE(is_readable(fd));
+    }
+
+    SUBCASE("Requesting the eventfd doesn't make a thread take the pooled calls")
+    {
+        std::atomic<int> received = 0;
+        sisl::connect(sig, [&received](int value) { received = value; }, std::thread::id(), sisl::type_connection::pooled);
+        std::thread([&sig, &received]()
+        {
+            const int fd = sisl::event_fd();
+            emit sig(5); // Not a worker: lands in the shared queue of the pool
+            CHECK_FALSE(is_readable(fd));
+            CHECK(sisl::next_timer_delay() == sisl::blocking_polling);
+            CHECK(received == 0);
+        }).join();
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+        CHECK(received == 5);
+    }
+
+    SUBCASE("Calls pending before the request make the eventfd readable")
+    {
+        int pipe_fds[2];
+        REQUIRE(::pipe(pipe_fds) == 0);
+        sisl::event_loop loop;
+        sisl::connect(sig, [&pipe_fds](int value)
+        {
+            const char byte = static_cast<char>(value);
+            CHECK(::write(pipe_fds[1], &byte, 1) == 1);
+        }, loop, sisl::type_connection::queued);
+        emit sig(7);
+        CHECK(is_readable(loop.event_fd()));
+        CHECK_FALSE(is_readable(pipe_fds[0]));
+        loop.poll();
+        CHECK(is_readable(pipe_fds[0]));
+        char byte = 0;
+        CHECK(::read(pipe_fds[0], &byte, 1) == 1);
+        CHECK(byte == 7);
+        ::close(pipe_fds[0]);
+        ::close(pipe_fds[1]);
+    }
+}
+#endif // __linux__
+
+struct SlowReceiver
+{
+    void on_value(int delay_ms) { std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms)); }
+};
+
+TEST_CASE("Slow slot detector")
+{
+    struct handler_reset
+    {
+        ~handler_reset() { sisl::set_slow_slot_handler(std::chrono::nanoseconds(0), nullptr); }
+    } reset;
+    Emitter emitter;
+    SlowReceiver receiver;
+    std::vector<sisl::slow_slot_report> reports;
+    sisl::set_slow_slot_handler(std::chrono::milliseconds(5), [&reports](const sisl::slow_slot_report& report) { reports.push_back(report); });
+
+    SUBCASE("Direct slots")
+    {
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &SlowReceiver::on_value, std::thread::id(), sisl::type_connection::direct);
+        emit emitter.int_signal(0);
+        CHECK(reports.empty());
+        emit emitter.int_signal(10);
+        REQUIRE(reports.size() == 1);
+        CHECK(reports[0].signal == &emitter.int_signal);
+        CHECK(reports[0].sender == &emitter);
+        CHECK(reports[0].receiver == &receiver);
+        CHECK(reports[0].type == sisl::type_connection::direct);
+        CHECK(reports[0].duration >= std::chrono::milliseconds(10));
+    }
+
+    SUBCASE("Queued slots are reported by the polling thread")
+    {
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &SlowReceiver::on_value, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit emitter.int_signal(10);
+        CHECK(reports.empty());
+        sisl::poll();
+        REQUIRE(reports.size() == 1);
+        CHECK(reports[0].signal == &emitter.int_signal);
+        CHECK(reports[0].type == sisl::type_connection::queued);
+    }
+
+    SUBCASE("Disabled detector")
+    {
+        sisl::set_slow_slot_handler(std::chrono::milliseconds(5), nullptr);
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &SlowReceiver::on_value, std::thread::id(), sisl::type_connection::direct);
+        emit emitter.int_signal(10);
+        CHECK(reports.empty());
+    }
+}
+
+struct Doubler
+{
+    int twice(int value) { return 2 * value; }
+};
+
+struct SharedDoubler : public std::enable_shared_from_this<SharedDoubler>
+{
+    int twice(int value) { return 2 * value; }
+};
+
+template<typename... TARGS>
+static std::size_t nb_signal_args(sisl::signal<TARGS...>&)
+{
+    return sizeof...(TARGS);
+}
+
+TEST_CASE("Combiners")
+{
+    sisl::result_signal<int(int)> sig;
+    Doubler doubler;
+
+    SUBCASE("The argument types of a signal are deducible")
+    {
+        sisl::signal<int, float> plain;
+        CHECK(nb_signal_args(plain) == 2);
+    }
+
+    SUBCASE("Direct slots")
+    {
+        CHECK_FALSE(sig.collect(sisl::combiner::last<int>(), 1).has_value());
+        sisl::connect(sig, doubler, &Doubler::twice);
+        sisl::connect(sig, [](int value) { return value + 1; });
+        sisl::connect(sig, [](int value) { return value - 1; });
+        CHECK(sig.collect(sisl::combiner::last<int>(), 10) == 9);
+        CHECK(sig.collect(sisl::combiner::sum<int>(), 10) == 40);
+        CHECK(sig.collect(sisl::combiner::minimum<int>(), 10) == 9);
+        CHECK(sig.collect(sisl::combiner::maximum<int>(), 10) == 20);
+        CHECK(sig.collect(sisl::combiner::reduce(1, std::multiplies<int>()), 10) == 20 * 11 * 9);
+        emit sig(10); // results are discarded
+    }
+
+    SUBCASE("Dead receivers are skipped")
+    {
+        auto sp_doubler = std::make_shared<SharedDoubler>();
+        sisl::connect(sig, *sp_doubler, &SharedDoubler::twice);
+        sisl::connect(sig, [](int value) { return value; });
+        CHECK(sig.collect(sisl::combiner::sum<int>(), 10) == 30);
+        sp_doubler.reset();
+        CHECK(sig.collect(sisl::combiner::sum<int>(), 10) == 10);
+    }
+
+    SUBCASE("Blocking queued slots")
+    {
+        sisl::result_signal<bool(int)> check;
+        sisl::jthread worker([](std::stop_token token)
+        {
+            while (!token.stop_requested())
+                sisl::poll(std::chrono::milliseconds(1));
+        });
+        sisl::connect(check, [](int value) { return value > 0; }, worker.get_id(), sisl::type_connection::blocking_queued);
+        sisl::connect(check, [](int value) { return value < 100; });
+        CHECK(check.collect(sisl::combiner::all_of(), 10));
+        CHECK_FALSE(check.collect(sisl::combiner::all_of(), -10));
+        CHECK_FALSE(check.collect(sisl::combiner::all_of(), 200));
+    }
+
+    SUBCASE("Queued slots are awaited by collect_async()")
+    {
+        sisl::connect(sig, doubler, &Doubler::twice, std::this_thread::get_id(), sisl::type_connection::queued);
+        sisl::connect(sig, [](int value) { return value; });
+        CHECK(sig.collect(sisl::combiner::sum<int>(), 10) == 10); // queued result is discarded
+        CHECK(sisl::poll() == sisl::polling_result::slots_invoked);
+
+        std::future<int> result = sig.collect_async(sisl::combiner::sum<int>(), 10);
+        CHECK(result.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+        sisl::poll();
+        REQUIRE(result.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        CHECK(result.get() == 30);
+    }
+}
+
+TEST_CASE("Batch emission")
+{
+    const std::vector<int> batch = { 1, 2, 3, 4 };
+
+    SUBCASE("Direct slots")
+    {
+        sisl::signal<int> sig;
+        std::vector<int> received;
+        std::vector<std::size_t> batch_sizes;
+        sisl::connect(sig, [&received](int value) { received.push_back(value); });
+        sisl::connect_batch(sig, [&batch_sizes](std::span<const int> values) { batch_sizes.push_back(values.size()); });
+        sig.emit_batch(batch);
+        CHECK(received == batch);
+        REQUIRE(batch_sizes.size() == 1);
+        CHECK(batch_sizes[0] == batch.size());
+
+        emit sig(5); // a single emission is a batch of one payload
+        REQUIRE(batch_sizes.size() == 2);
+        CHECK(batch_sizes[1] == 1);
+        sig.emit_batch(std::span<const int>()); // empty batches are ignored
+        CHECK(batch_sizes.size() == 2);
+    }
+
+    SUBCASE("Signals with several arguments")
+    {
+        sisl::signal<int, const std::string&> sig;
+        std::string received;
+        sisl::connect(sig, [&received](int count, const std::string& text) { received.append(static_cast<std::size_t>(count), text[0]); });
+        const std::vector<std::tuple<int, std::string>> payloads = { { 1, "a" }, { 2, "b" } };
+        sig.emit_batch(payloads);
+        CHECK(received == "abb");
+    }
+
+    SUBCASE("Queued slots of a same thread share one queued call")
+    {
+        sisl::signal<int> sig;
+        std::vector<int> received;
+        std::vector<std::size_t> batch_sizes;
+        sisl::connect(sig, [&received](int value) { received.push_back(value); }, std::this_thread::get_id(), sisl::type_connection::queued);
+        sisl::connect_batch(sig, [&batch_sizes](std::span<const int> values) { batch_sizes.push_back(values.size()); }, std::this_thread::get_id(), sisl::type_connection::queued);
+#ifdef SISL_INSTRUMENTATION
+        const sisl::statistics before = sisl::get_statistics();
+#endif // SISL_INSTRUMENTATION
+        sig.emit_batch(batch);
+#ifdef SISL_INSTRUMENTATION
+        CHECK(sisl::get_statistics().queued_posts - before.queued_posts == 1);
+#endif // SISL_INSTRUMENTATION
+        CHECK(received.empty());
+        sisl::poll();
+        CHECK(received == batch);
+        REQUIRE(batch_sizes.size() == 1);
+        CHECK(batch_sizes[0] == batch.size());
+    }
+
+    SUBCASE("Blocking queued slots")
+    {
+        sisl::signal<int> sig;
+        std::atomic<int> sum = 0;
+        sisl::jthread worker([](std::stop_token token)
+        {
+            while (!token.stop_requested())
+                sisl::poll(std::chrono::milliseconds(1));
+        });
+        sisl::connect(sig, [&sum](int value) { sum += value; }, worker.get_id(), sisl::type_connection::blocking_queued);
+        sig.emit_batch(batch);
+        CHECK(sum == 10);
+        sisl::connect(sig, [](int) {}, std::this_thread::get_id(), sisl::type_connection::blocking_queued);
+        CHECK_THROWS_AS(sig.emit_batch(batch), sisl::invalid_blocking_queued_connection);
+        CHECK(sum == 10); // nothing is posted
+    }
+}
+
+struct CopyCounter
+{
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter& other) : copies(other.copies + 1), moves(other.moves) {}
+    CopyCounter(CopyCounter&& other) noexcept : copies(other.copies), moves(other.moves + 1) {}
+    CopyCounter& operator=(const CopyCounter&) = delete;
+
+    int copies = 0;     ///< Copies since the original object.
+    int moves = 0;
+};
+
+TEST_CASE("Move-only and moved payloads")
+{
+    SUBCASE("Move-only arguments")
+    {
+        sisl::signal<std::unique_ptr<int>> sig;
+        int received = 0;
+        sisl::connect(sig, [&received](std::unique_ptr<int> value) { received = *value; }, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit sig(std::make_unique<int>(42));
+        CHECK(received == 0);
+        sisl::poll();
+        CHECK(received == 42);
+
+        sisl::disconnect_all(sig);
+        sisl::connect(sig, [&received](const std::unique_ptr<int>& value) { received = *value; });
+        emit sig(std::make_unique<int>(7));
+        CHECK(received == 7);
+
+        sisl::connect(sig, [](std::unique_ptr<int>) {});
+        CHECK_THROWS_AS(emit sig(std::make_unique<int>(1)), sisl::invalid_move_only_emission);
+    }
+
+    SUBCASE("The rvalues are moved to a single queued receiver")
+    {
+        sisl::signal<CopyCounter> sig;
+        CopyCounter received;
+        sisl::connect(sig, [&received](CopyCounter value) { received.copies = value.copies; received.moves = value.moves; }, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit sig(CopyCounter());
+        sisl::poll();
+        CHECK(received.copies == 0);
+        CHECK(received.moves >= 2); // into the payload, then into the slot
+
+        CopyCounter lvalue;
+        emit sig(lvalue); // an lvalue is copied into the payload
+        sisl::poll();
+        CHECK(received.copies == 2);
+    }
+
+    SUBCASE("The payload of several receivers is copied once")
+    {
+        sisl::signal<CopyCounter> sig;
+        std::vector<int> copies;
+        for (int i = 0; i < 3; ++i)
+            sisl::connect(sig, [&copies](const CopyCounter& value) { copies.push_back(value.copies); }, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit sig(CopyCounter());
+        sisl::poll();
+        CHECK(copies == std::vector<int>{ 1, 1, 1 });
+    }
+}
+
+struct Frame
+{
+    explicit Frame(int id) : id(id) {}
+    int id;
+};
+
+struct PooledFrame : public sisl::intrusive_payload
+{
+    explicit PooledFrame(std::vector<const PooledFrame*>& pool) : pool(pool) {}
+    void recycle() const noexcept override { pool.push_back(this); }
+    std::vector<const PooledFrame*>& pool;
+};
+
+TEST_CASE("Shared payloads")
+{
+    SUBCASE("The payload is shared by the direct and queued slots")
+    {
+        sisl::signal<sisl::shared_payload<Frame>> sig;
+        std::vector<const Frame*> received;
+        sisl::connect(sig, [&received](const Frame& frame) { received.push_back(&frame); });
+        sisl::connect(sig, [&received](const Frame& frame) { received.push_back(&frame); }, std::this_thread::get_id(), sisl::type_connection::queued);
+        std::uint32_t refs_in_slot = 0;
+        sisl::connect(sig, [&refs_in_slot](const sisl::shared_payload<Frame>& frame) { refs_in_slot = frame.use_count(); }, std::this_thread::get_id(), sisl::type_connection::queued);
+
+        sisl::shared_payload<Frame> frame = sisl::make_shared_payload<Frame>(42);
+        emit sig(frame);
+        CHECK(frame.use_count() == 3); // held by the two queued calls
+        sisl::poll();
+        CHECK(frame.use_count() == 1);
+        CHECK(refs_in_slot >= 2);
+        REQUIRE(received.size() == 2);
+        CHECK(received[0] == &frame.get());
+        CHECK(received[1] == &frame.get());
+        CHECK(frame->id == 42);
+    }
+
+    SUBCASE("Intrusive payloads are recycled by their last handle")
+    {
+        std::vector<const PooledFrame*> pool;
+        PooledFrame pooled_frame(pool);
+        sisl::signal<sisl::shared_payload<PooledFrame>> sig;
+        sisl::connect(sig, [](const PooledFrame&) {}, std::this_thread::get_id(), sisl::type_connection::queued);
+        {
+            sisl::shared_payload<PooledFrame> frame(&pooled_frame);
+            emit sig(frame);
+        }
+        CHECK(pool.empty());
+        sisl::poll();
+        REQUIRE(pool.size() == 1);
+        CHECK(pool[0] == &pooled_frame);
+    }
+}
+
+struct CountingAllocator
+{
+    static void* allocate(std::size_t size, std::size_t alignment)
+    {
+        ++allocations;
+        return sisl::thread_pool_allocator::allocate(size, alignment);
+    }
+
+    static void deallocate(void* p_block, std::size_t size, std::size_t alignment) noexcept
+    {
+        ++deallocations;
+        sisl::thread_pool_allocator::deallocate(p_block, size, alignment);
+    }
+
+    static inline std::atomic<int> allocations = 0;
+    static inline std::atomic<int> deallocations = 0;
+};
+
+TEST_CASE("Allocators")
+{
+    SUBCASE("Thread pools recycle the blocks")
+    {
+        void* p_aligned = sisl::thread_pool_allocator::allocate(100, 64);
+        CHECK(reinterpret_cast<std::uintptr_t>(p_aligned) % 64 == 0);
+        sisl::thread_pool_allocator::deallocate(p_aligned, 100, 64);
+
+        // The largest size class, not used by SISL itself
+        void* p_block = sisl::thread_pool_allocator::allocate(2000, 8);
+        sisl::thread_pool_allocator::deallocate(p_block, 2000, 8);
+        CHECK(sisl::thread_pool_allocator::allocate(2000, 8) == p_block);
+
+        // Released by another thread: pushed on the remote-free list, then taken back by the owner
+        std::thread([p_block] { sisl::thread_pool_allocator::deallocate(p_block, 2000, 8); }).join();
+        CHECK(sisl::thread_pool_allocator::allocate(2000, 8) == p_block);
+        sisl::thread_pool_allocator::deallocate(p_block, 2000, 8);
+
+        void* p_big = sisl::thread_pool_allocator::allocate(1 << 20, 8); // forwarded to operator new
+        sisl::thread_pool_allocator::deallocate(p_big, 1 << 20, 8);
+    }
+
+    SUBCASE("Slots and queued arguments use the allocator of the signal")
+    {
+        {
+            sisl::basic_signal<sisl::signal_policy<SISL_DELEGATE_STORAGE_SIZE, SISL_SLOTS_MUTEX, void, CountingAllocator>, std::string> sig;
+            std::string received;
+            sisl::connect(sig, [&received](const std::string& text) { received = text; }, std::this_thread::get_id(), sisl::type_connection::queued);
+            const int after_connect = CountingAllocator::allocations;
+            CHECK(after_connect >= 1);
+            emit sig(std::string(100, 'x'));
+#ifndef SISL_NUMA_AWARE // the arguments are allocated on the node of the receiver
+            CHECK(CountingAllocator::allocations > after_connect);
+#endif // SISL_NUMA_AWARE
+            sisl::poll();
+            CHECK(received.size() == 100);
+        }
+        CHECK(CountingAllocator::allocations == CountingAllocator::deallocations);
+    }
+}
+
+#ifdef SISL_NUMA_AWARE
+TEST_CASE("NUMA awareness")
+{
+    SUBCASE("Queued emissions are allocated on the node of the receiver")
+    {
+        sisl::signal<std::string> sig;
+        std::string received;
+        sisl::connect(sig, [&received](const std::string& text) { received = text; }, std::this_thread::get_id(), sisl::type_connection::queued);
+        sisl::poll(std::chrono::milliseconds(0)); // the queue follows the node of its consumer
+        CHECK(sisl::priv::numa_node_of(std::this_thread::get_id()) == sisl::priv::current_numa_node());
+        emit sig(std::string(100, 'x'));
+        sisl::poll();
+        CHECK(received.size() == 100);
+    }
+
+    SUBCASE("Blocks bound to a node are recycled")
+    {
+        const int node = sisl::priv::current_numa_node();
+        void* p_block = sisl::priv::allocate_on_node(200, node);
+        sisl::priv::deallocate_on_node(p_block, 200, node);
+        CHECK(sisl::priv::allocate_on_node(200, node) == p_block);
+
+        // Released by the consumer thread: pushed on the remote-free list, then taken back by the emitter
+        std::thread([p_block, node] { sisl::priv::deallocate_on_node(p_block, 200, node); }).join();
+        CHECK(sisl::priv::allocate_on_node(200, node) == p_block);
+        sisl::priv::deallocate_on_node(p_block, 200, node);
+
+        // Not bound to a node: forwarded to operator new
+        void* p_global = sisl::priv::allocate_on_node(200, -1);
+        sisl::priv::deallocate_on_node(p_global, 200, -1);
+    }
+}
+#endif // SISL_NUMA_AWARE
+
+static std::size_t count_registered_thread_queues()
+{
+    std::size_t count = 0;
+    for (auto& shard : sisl::priv::hashmap_signal_queue::instance().m_shards)
+    {
+        std::shared_lock lock(shard.m_mutex);
+        count += shard.m_async_delegates.size();
+    }
+    return count;
+}
+
+TEST_CASE("Thread queues registry")
+{
+    SUBCASE("Queues of exited threads are removed")
+    {
+        const std::size_t nb_queues = count_registered_thread_queues();
+        for (int i = 0; i < 100; ++i)
+        {
+            std::thread thread([]() { sisl::poll(std::chrono::milliseconds(0)); });
+            thread.join();
+        }
+        CHECK(count_registered_thread_queues() == nb_queues);
+
+        // A sisl::jthread that never polled its queue
+        sisl::signal<int> sig;
+        Receiver receiver;
+        {
+            std::atomic_bool stop = false;
+            sisl::jthread worker([&stop]() { while (!stop) std::this_thread::yield(); });
+            sisl::connect(sig, receiver, &Receiver::receive_int, worker.get_id(), sisl::type_connection::queued);
+            emit sig(1);
+            stop = true;
+        }
+        CHECK(count_registered_thread_queues() == nb_queues);
+        CHECK(receiver.m_counter == 0);
+    }
+
+    SUBCASE("Receivers that exit without polling don't leak their queue")
+    {
+        const std::size_t nb_queues = count_registered_thread_queues();
+        std::thread timer_reader([]() { CHECK(sisl::next_timer_delay() == sisl::blocking_polling); });
+        timer_reader.join();
+        CHECK(count_registered_thread_queues() == nb_queues);
+
+        // Plain std::threads (alive together, so with distinct ids) receiving queued calls and exiting without polling:
+        // at most SISL_MAX_PENDING_THREAD_QUEUES queues wait for a first poll
+        sisl::signal<int> sig;
+        std::atomic<int> dropped = 0;
+        std::atomic_bool emitted = false;
+        std::vector<std::thread> receivers;
+        for (int i = 0; i < 2 * SISL_MAX_PENDING_THREAD_QUEUES; ++i)
+        {
+            receivers.emplace_back([&emitted]() { while (!emitted) std::this_thread::yield(); });
+            sisl::connect(sig, [&dropped](int) { dropped++; }, receivers.back().get_id(), sisl::type_connection::queued);
+        }
+        emit sig(1);
+        emitted = true;
+        std::vector<std::thread::id> receiver_ids;
+        for (std::thread& receiver : receivers)
+        {
+            receiver_ids.push_back(receiver.get_id());
+            receiver.join();
+        }
+        CHECK(count_registered_thread_queues() <= nb_queues + SISL_MAX_PENDING_THREAD_QUEUES);
+        CHECK(dropped == 0);
+        // The kept ones are dropped like the queues of joined sisl::jthreads (the next threads may reuse the ids)
+        for (std::thread::id receiver_id : receiver_ids)
+            sisl::priv::forget_thread_queue(receiver_id);
+        CHECK(count_registered_thread_queues() <= nb_queues); // The pending queues of the previous tests may have been dropped too
+        sisl::disconnect_all(sig);
+
+        // The calls queued before the first poll of a thread are still invoked
+        std::atomic<int> counter = 0;
+        std::atomic_bool polling = false;
+        std::thread receiver([&polling]() { while (!polling) std::this_thread::yield(); sisl::poll(); });
+        sisl::connect(sig, [&counter](int) { counter++; }, receiver.get_id(), sisl::type_connection::queued);
+        emit sig(0);
+        polling = true;
+        receiver.join();
+        CHECK(counter == 1);
+    }
+
+    SUBCASE("New threads don't inherit the terminated queue of a previous thread")
+    {
+        sisl::signal<> sig;
+        std::atomic<int> counter = 0;
+        for (int i = 0; i < 50; ++i)
+        {
+            sisl::jthread worker([](std::stop_token token)
+            {
+                while (!token.stop_requested() && sisl::poll(sisl::blocking_polling) != sisl::polling_result::terminated)
+                {
+                }
+            });
+            sisl::scoped_connection connection = sisl::connect(sig, [&counter]() { counter++; }, worker.get_id(), sisl::type_connection::blocking_queued);
+            emit sig();
+        }
+        CHECK(counter == 50);
+    }
+}
+
+#ifdef SISL_INSTRUMENTATION
+static const sisl::statistics::thread_queue* thread_queue_of(const sisl::statistics& stats, std::thread::id thread_id)
+{
+    for (const auto& queue : stats.thread_queues)
+    {
+        if (queue.thread_id == thread_id)
+            return &queue;
+    }
+    return nullptr;
+}
+
+static std::size_t queue_depth_of(const sisl::statistics& stats, std::thread::id thread_id)
+{
+    const sisl::statistics::thread_queue* p_queue = thread_queue_of(stats, thread_id);
+    return p_queue ? p_queue->depth : 0;
+}
+
+TEST_CASE("Instrumentation")
+{
+    sisl::signal<int> sig;
+    Receiver receiver;
+
+    SUBCASE("Direct and queued invocations")
+    {
+        const sisl::statistics before = sisl::get_statistics();
+        emit sig(0); // Not connected: not counted
+        sisl::connect(sig, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::direct);
+        sisl::connect(sig, receiver, &Receiver::receive_int, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit sig(1);
+        emit sig(2);
+        CHECK(sig.emit_count() == 2);
+
+        const sisl::statistics pending = sisl::get_statistics();
+        CHECK(pending.emits - before.emits == 2);
+        CHECK(pending.direct_invocations - before.direct_invocations == 2);
+        CHECK(pending.queued_posts - before.queued_posts == 2);
+        CHECK(queue_depth_of(pending, std::this_thread::get_id()) == 2);
+
+        sisl::poll();
+        const sisl::statistics after = sisl::get_statistics();
+        CHECK(after.queued_invocations - before.queued_invocations == 2);
+        CHECK(after.max_queue_latency_ns >= before.max_queue_latency_ns);
+        CHECK(queue_depth_of(after, std::this_thread::get_id()) == 0);
+        CHECK(receiver.m_counter == 4);
+    }
+
+    SUBCASE("Emissions of several threads and calls dropped by a terminated loop")
+    {
+        std::atomic<int> received{ 0 };
+        sisl::connect(sig, [&received](int) { ++received; }, std::thread::id(), sisl::type_connection::direct);
+        std::vector<std::thread> emitters;
+        for (int i = 0; i < 4; ++i)
+            emitters.emplace_back([&sig]() { for (int j = 0; j < 100; ++j) emit sig(j); });
+        for (std::thread& emitter : emitters)
+            emitter.join();
+        CHECK(sig.emit_count() == 400); // Summed over the stripes of the emitters
+        CHECK(received == 400);
+
+        sisl::event_loop loop;
+        sisl::connect(sig, receiver, &Receiver::receive_int, loop, sisl::type_connection::queued);
+        loop.terminate();
+        const sisl::statistics before = sisl::get_statistics();
+        emit sig(1);
+        CHECK(sisl::get_statistics().queued_posts == before.queued_posts); // Dropped, not posted
+        CHECK(loop.poll() == sisl::polling_result::terminated);
+        CHECK(receiver.m_counter == 0);
+    }
+
+    SUBCASE("Blocking queued waits and counters of exited threads")
+    {
+        const sisl::statistics before = sisl::get_statistics();
+        {
+            sisl::jthread worker([](std::stop_token token)
+            {
+                while (!token.stop_requested() && sisl::poll(sisl::blocking_polling) != sisl::polling_result::terminated)
+                {
+                }
+            });
+            sisl::connect(sig, [](int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }, worker.get_id(), sisl::type_connection::blocking_queued);
+            emit sig(1);
+        }
+        const sisl::statistics after = sisl::get_statistics();
+        CHECK(after.blocking_waits - before.blocking_waits == 1);
+        CHECK(after.blocking_wait_ns - before.blocking_wait_ns >= 2000000);
+        CHECK(after.queued_invocations - before.queued_invocations == 1); // Counted by the exited worker
+        CHECK(after.queue_latency_ns >= before.queue_latency_ns);
+    }
+
+    SUBCASE("Latency histogram buckets")
+    {
+        using histogram = sisl::latency_histogram;
+        for (std::uint64_t ns : { 0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 1000ull, 123456789ull, 1ull << 39 })
+        {
+            const std::size_t bucket = histogram::bucket_of(ns);
+            CHECK(histogram::lower_bound(bucket) <= ns);
+            CHECK(ns <= histogram::upper_bound(bucket));
+            CHECK(histogram::upper_bound(bucket) - histogram::lower_bound(bucket) <= std::max<std::uint64_t>(ns / 8, 1));
+        }
+        CHECK(histogram::bucket_of(UINT64_MAX) == histogram::nb_buckets - 1); // Clamped in the last bucket
+
+        histogram latencies;
+        latencies.buckets[histogram::bucket_of(100)] = 99;
+        latencies.buckets[histogram::bucket_of(100000)] = 1;
+        CHECK(latencies.count() == 100);
+        CHECK(latencies.value_at_percentile(50) == histogram::upper_bound(histogram::bucket_of(100)));
+        CHECK(latencies.value_at_percentile(100) == histogram::upper_bound(histogram::bucket_of(100000)));
+    }
+
+    SUBCASE("Queue latency per thread and per event loop")
+    {
+        sisl::connect(sig, receiver, &Receiver::receive_int, std::this_thread::get_id(), sisl::type_connection::queued);
+        sisl::poll(); // Registers the queue of the thread
+        const sisl::statistics before = sisl::get_statistics();
+        REQUIRE(thread_queue_of(before, std::this_thread::get_id()) != nullptr);
+        emit sig(1);
+        emit sig(2);
+        sisl::poll();
+        const sisl::statistics after = sisl::get_statistics();
+        CHECK(thread_queue_of(after, std::this_thread::get_id())->latency.count() - thread_queue_of(before, std::this_thread::get_id())->latency.count() == 2);
+
+        sisl::event_loop loop;
+        sisl::signal<int> loop_sig;
+        sisl::connect(loop_sig, receiver, &Receiver::receive_int, loop, sisl::type_connection::queued);
+        emit loop_sig(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        loop.poll();
+        const sisl::latency_histogram loop_latency = loop.get_queue_latency();
+        CHECK(loop_latency.count() == 1);
+        CHECK(loop_latency.value_at_percentile(100) >= 1000000);
+    }
+}
+#endif // SISL_INSTRUMENTATION
+
+#ifdef SISL_TRACING
+static std::string pointer_string(const void* p)
+{
+    std::ostringstream stream;
+    stream << "\"0x" << std::hex << reinterpret_cast<std::uintptr_t>(p) << '"';
+    return stream.str();
+}
+
+TEST_CASE("Tracing")
+{
+    Emitter emitter;
+    Receiver receiver;
+
+    SUBCASE("Emissions, queued calls and slots are traced")
+    {
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::direct);
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::this_thread::get_id(), sisl::type_connection::queued);
+        emit emitter.int_signal(1);
+        sisl::poll();
+        CHECK(receiver.m_counter == 2);
+
+        std::ostringstream stream;
+        sisl::dump_trace(stream);
+        const std::string trace = stream.str();
+        CHECK(trace.starts_with("{\"traceEvents\":["));
+        CHECK(trace.find("\"signal\":" + pointer_string(&emitter.int_signal)) != std::string::npos);
+        CHECK(trace.find("\"sender\":" + pointer_string(&emitter)) != std::string::npos);
+        CHECK(trace.find("\"type\":\"direct\"") != std::string::npos);
+        CHECK(trace.find("\"type\":\"queued\"") != std::string::npos);
+        // The queued call is a flow from its enqueue to its dequeue
+        CHECK(trace.find("\"ph\":\"s\"") != std::string::npos);
+        CHECK(trace.find("\"ph\":\"f\"") != std::string::npos);
+    }
+
+    SUBCASE("Dumping while other threads trace")
+    {
+        std::atomic_bool stop = false;
+        sisl::connect(emitter, &Emitter::int_signal, receiver, &Receiver::receive_int, std::thread::id(), sisl::type_connection::direct);
+        std::thread tracer([&emitter, &stop]()
+        {
+            while (!stop)
+                emit emitter.int_signal(1);
+        });
+        for (int i = 0; i < 20; ++i)
+        {
+            std::ostringstream stream;
+            sisl::dump_trace(stream);
+            CHECK(stream.str().ends_with("],\"displayTimeUnit\":\"ns\"}\n"));
+        }
+        stop = true;
+        tracer.join();
+    }
+
+    SUBCASE("Unwritable file")
+    {
+        CHECK_THROWS_AS(sisl::dump_trace(std::string("/nonexistent_directory/trace.json")), std::runtime_error);
+    }
+
+    SUBCASE("Ring segments on demand and buffers of exited threads")
+    {
+        static sisl::signal<int> exited_sig; // Only emitted by the exited thread (its address is not reused by the other tests)
+        sisl::connect(exited_sig, [](int) {});
+        std::size_t nb_segments = 0;
+        std::thread tracer([&nb_segments]()
+        {
+            emit exited_sig(1);
+            for (const auto& segment : sisl::priv::gtl_trace_buffer_owner.m_sp_buffer->m_segments)
+                nb_segments += segment.load() != nullptr;
+        });
+        tracer.join();
+        CHECK(nb_segments == 1); // A few events: only the first segment of the ring
+
+        const std::string signal = "\"signal\":" + pointer_string(&exited_sig);
+        std::ostringstream before;
+        sisl::dump_trace(before);
+        CHECK(before.str().find(signal) != std::string::npos); // Kept after the exit of the thread
+
+        sisl::clear_exited_traces();
+        std::ostringstream after;
+        sisl::dump_trace(after);
+        CHECK(after.str().find(signal) == std::string::npos);
+    }
+}
+#endif // SISL_TRACING
+
 struct CCopyCounterNonMovable
 {
     CCopyCounterNonMovable(int& copy_counter) : copy_counter(copy_counter)
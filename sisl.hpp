@@ -107,6 +107,115 @@
 #define SISL_MAX_SLOTS_LOCK_FREE_RING_QUEUE 256
 #endif // SISL_USE_LOCK_FREE_RING_QUEUE && !SISL_MAX_SLOTS_LOCK_FREE_RING_QUEUE
 
+#ifndef SISL_DELEGATE_STORAGE_SIZE
+/**
+ * @def SISL_DELEGATE_STORAGE_SIZE
+ * @brief Specifies the default size (in bytes) of the inline storage of a slot's callable.
+ *
+ * Callables that fit in this storage are stored inline in the slot, bigger (or over-aligned) ones are stored
+ * in a pooled heap block instead. The default (32) fits a member function slot (weak pointer + method pointer).
+ * It can be overridden per signal through sisl::signal_policy (see sisl::sized_signal).
+ */
+#define SISL_DELEGATE_STORAGE_SIZE 32
+#endif // SISL_DELEGATE_STORAGE_SIZE
+
+#ifndef SISL_SLOTS_MUTEX
+/**
+ * @def SISL_SLOTS_MUTEX
+ * @brief Specifies the default mutex type protecting the slots list of a signal.
+ *
+ * The list (and so the mutex) is only allocated by the first connection of a signal, an unconnected signal is one pointer.
+ * Any Lockable type can be used, e.g. sisl::spin_mutex for one byte per connected signal instead of a std::shared_mutex,
+ * emissions then lock the list exclusively during their snapshot of the slots.
+ * It can be overridden per signal through sisl::signal_policy.
+ */
+#define SISL_SLOTS_MUTEX std::shared_mutex
+#endif // SISL_SLOTS_MUTEX
+
+#ifndef SISL_MAX_PENDING_THREAD_QUEUES
+/**
+ * @def SISL_MAX_PENDING_THREAD_QUEUES
+ * @brief Specifies the maximum number of queues kept for the threads that received queued calls but haven't polled yet (default is 64).
+ *
+ * A queued emission to a thread that never polled creates its queue, the calls wait there for the thread's first poll.
+ * Beyond this number, the oldest of these queues is dropped with its calls: a receiver thread that exits without polling
+ * (a plain std::thread, not a sisl::jthread) doesn't leak its queue.
+ */
+#define SISL_MAX_PENDING_THREAD_QUEUES 64
+#endif // SISL_MAX_PENDING_THREAD_QUEUES
+
+#ifndef SISL_ALLOCATOR
+/**
+ * @def SISL_ALLOCATOR
+ * @brief Specifies the allocator of the queue nodes and of the queued calls, and the default allocator of the signals.
+ *
+ * An allocator is a type with two static functions:
+ *   static void* allocate(std::size_t size, std::size_t alignment);
+ *   static void deallocate(void* p_block, std::size_t size, std::size_t alignment) noexcept;
+ * The default (sisl::heap_allocator) uses the global operator new. sisl::thread_pool_allocator pools the blocks per thread
+ * (size classes, with remote-free lists for the blocks released by the other threads), so emissions don't contend on malloc.
+ * The allocator of the slots and of the arguments of the queued emissions can be overridden per signal through sisl::signal_policy.
+ */
+#define SISL_ALLOCATOR SISL_NAMESPACE::heap_allocator
+#endif // SISL_ALLOCATOR
+
+/**
+ * #def SISL_NUMA_AWARE
+ * @brief Allocates the queued calls on the NUMA node of the thread consuming them (Linux only).
+ *
+ * When defined, the nodes of the signal queues are allocated on the NUMA node of the thread polling the queue,
+ * and the arguments of a queued emission on the node of its (first) receiver, so the consumer doesn't read remote memory.
+ * The topology is read from sysfs (/sys/devices/system/node) and the memory is bound with mbind, no external library is needed.
+ * Without effect on single node machines (the allocations are then local anyway).
+*/
+// #define SISL_NUMA_AWARE
+
+#if defined(SISL_NUMA_AWARE) && !defined(__linux__)
+#error "SISL_NUMA_AWARE is only supported on Linux"
+#endif // SISL_NUMA_AWARE && !__linux__
+
+/**
+ * #def SISL_INSTRUMENTATION
+ * @brief Enables the instrumentation counters of SISL (see sisl::get_statistics()).
+ *
+ * When defined, SISL counts the emissions, the direct and queued invocations, the enqueue-to-execution latency of queued calls,
+ * the time spent waiting for blocking_queued slots, the queue_full events and the depth of the thread queues.
+ * The global counters are per thread (relaxed load + store, without atomic read-modify-write); the emissions of a signal are counted
+ * in per-thread stripes of the signal and the depth of a queue in a producer counter and a consumer counter, on separate cache lines.
+ * They are cheap enough to be kept in production builds.
+ * When not defined, the instrumentation hooks compile to nothing.
+*/
+// #define SISL_INSTRUMENTATION
+
+/**
+ * #def SISL_TRACING
+ * @brief Enables the tracer of the signal flow (see sisl::dump_trace()).
+ *
+ * When defined, SISL records the emissions, the enqueues, the dequeues and the slot invocations (with the signal's address,
+ * the sender and the connection type) in a lock-free ring buffer per thread. sisl::dump_trace() writes them in the
+ * Chrome trace JSON format (chrome://tracing, ui.perfetto.dev), where the queued calls are drawn as flows between the threads.
+ * When not defined, the tracing hooks compile to nothing.
+*/
+// #define SISL_TRACING
+
+#if defined(SISL_TRACING) && !defined(SISL_TRACE_BUFFER_SIZE)
+/**
+ * @def SISL_TRACE_BUFFER_SIZE
+ * @brief Specifies the number of trace events kept per thread (a power of two, default is 8192), the oldest ones are overwritten.
+ */
+#define SISL_TRACE_BUFFER_SIZE 8192
+#endif // SISL_TRACING && !SISL_TRACE_BUFFER_SIZE
+
+#if defined(SISL_TRACING) && !defined(SISL_TRACE_MAX_EXITED_THREADS)
+/**
+ * @def SISL_TRACE_MAX_EXITED_THREADS
+ * @brief Specifies the number of exited threads whose trace events are kept for sisl::dump_trace() (default is 64, 0 keeps none).
+ *
+ * The buffers of the oldest exited threads are freed beyond, sisl::clear_exited_traces() frees all of them.
+ */
+#define SISL_TRACE_MAX_EXITED_THREADS 64
+#endif // SISL_TRACING && !SISL_TRACE_MAX_EXITED_THREADS
+
 // <=====================================================================================>
 // <=====================================================================================>
 // <=====================================================================================>
@@ -118,9 +227,24 @@
 #include <functional>
 #include <thread>
 #include <shared_mutex>
+#include <mutex>
 #include <future>
 #include <array>
 #include <memory>
+#include <cstddef>
+#include <new>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+#include <bit>
+#include <optional>
+#include <span>
+#include <utility>
+#ifdef SISL_TRACING
+#include <iosfwd>
+#include <string>
+#endif // SISL_TRACING
 
 
 namespace SISL_NAMESPACE
@@ -153,11 +277,46 @@ namespace SISL_NAMESPACE
 	 *
 	 * This function processes all queued signals for the current thread and invokes connected slots accordingly.
 	 * It is typically called in the main loop of a thread to allow multithreaded signal processing.
+	 * It also fires the due timers of the thread (see basic_signal::emit_after()): the wait ends at the nearest deadline at most.
 	 * 
 	 * @return A polling_result indicating whether slots were invoked, the operation timed out, or the SISL mechanism was terminated.
 	 */
 	polling_result poll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+	/**
+	 * @brief Returns the delay until the nearest timer of the current thread (see basic_signal::emit_after()), blocking_polling if it has none.
+	 *
+	 * The delay is rounded up to the millisecond, zero if a timer is due. It bounds the waits that don't go through poll() (see event_fd()).
+	 */
+	std::chrono::milliseconds next_timer_delay();
+
+#ifdef __linux__
+	/**
+	 * @brief Returns an eventfd of the current thread's queue, readable while calls are pending for the thread (Linux only).
+	 *
+	 * The descriptor can be waited on with the thread's other descriptors (epoll, poll, select), then poll() invokes the calls and resets it.
+	 * The timers don't make it readable: the wait is bounded by next_timer_delay(), and poll() fires them.
+	 * @code
+	 * epoll_event event{ EPOLLIN };
+	 * event.data.fd = sisl::event_fd();
+	 * epoll_ctl(epoll, EPOLL_CTL_ADD, event.data.fd, &event);
+	 * while (true)
+	 * {
+	 *     const auto delay = sisl::next_timer_delay();
+	 *     const int nb_events = epoll_wait(epoll, events, max_events, delay == sisl::blocking_polling ? -1 : static_cast<int>(delay.count()));
+	 *     ... // handles the sockets
+	 *     sisl::poll(); // invokes the pending calls and fires the due timers (non-blocking)
+	 * }
+	 * @endcode
+	 * The descriptor is created by the first call, and closed with the thread's queue (when the thread exits), it must not be closed by the caller.
+	 * It becomes readable too when the thread is terminated, and when a pooled call is pending while no worker sleeps in poll() (if the thread polls with poll() too).
+	 * Requesting it doesn't make the thread take the pooled calls of the other threads, only poll() does.
+	 *
+	 * @throws std::system_error if the eventfd can't be created.
+	 */
+	int event_fd();
+#endif // __linux__
+
 	/**
 	* @brief Terminates the SISL polling mechanism.
 	* 
@@ -184,6 +343,47 @@ namespace SISL_NAMESPACE
 		}
 	};
 
+	/**
+	* @class invalid_move_only_emission
+	* @brief Exception thrown when a signal with move-only arguments is emitted while several slots are connected.
+	*
+	* A move-only argument is moved to its slot, so it can only be received by a single slot.
+	*/
+	class invalid_move_only_emission : public std::runtime_error
+	{
+	public:
+		invalid_move_only_emission()
+			: std::runtime_error("A signal with move-only arguments can only be emitted to a single slot.")
+		{
+		}
+	};
+
+	/**
+	* @class invalid_concurrent_polling
+	* @brief Exception thrown when an event_loop is polled by a thread while another thread is already polling it.
+	*/
+	class invalid_concurrent_polling : public std::runtime_error
+	{
+	public:
+		invalid_concurrent_polling()
+			: std::runtime_error("An event loop can only be polled by one thread at a time.")
+		{
+		}
+	};
+
+	/**
+	* @class invalid_timer_period
+	* @brief Exception thrown when a periodic emission is scheduled with a period that is not strictly positive.
+	*/
+	class invalid_timer_period : public std::runtime_error
+	{
+	public:
+		invalid_timer_period()
+			: std::runtime_error("The period of a periodic emission must be strictly positive.")
+		{
+		}
+	};
+
 	/**
 	 * @class queue_full
 	 * @brief Exception thrown when the lock-free ring queue is full.
@@ -201,13 +401,175 @@ namespace SISL_NAMESPACE
 		}
 	};
 
+	/**
+	* @struct heap_allocator
+	* @brief Allocator using the global operator new (default SISL_ALLOCATOR).
+	*/
+	struct heap_allocator
+	{
+		static void* allocate(std::size_t size, std::size_t alignment)
+		{
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				return ::operator new(size, std::align_val_t(alignment));
+			return ::operator new(size);
+		}
+
+		static void deallocate(void* p_block, std::size_t size, std::size_t alignment) noexcept
+		{
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				::operator delete(p_block, size, std::align_val_t(alignment));
+			else
+				::operator delete(p_block, size);
+		}
+	};
+
+	/**
+	* @struct thread_pool_allocator
+	* @brief Allocator pooling the blocks per thread, by size class (see SISL_ALLOCATOR).
+	*
+	* Each thread allocates from its own pools, without lock. A block released by another thread is pushed (lock-free)
+	* on a remote-free list of its pool, taken back by the owner thread when its local free list is empty.
+	* The pools of exited threads are reused by the next threads, their memory is never given back to the system.
+	* The blocks bigger than the largest class (2 KiB) are forwarded to the global operator new.
+	*/
+	struct thread_pool_allocator
+	{
+		static void* allocate(std::size_t size, std::size_t alignment);
+		static void deallocate(void* p_block, std::size_t size, std::size_t alignment) noexcept;
+	};
+
+#ifdef SISL_INSTRUMENTATION
+	/**
+	* @class latency_histogram
+	* @brief Log-bucketed (HDR-style) histogram of the queueing delays of a queue, in nanoseconds.
+	*
+	* Each power of two is split in 8 linear sub-buckets, so a bucket is at most 12.5% wide, from 1ns to 2^40ns (~18 minutes).
+	* Longer delays are counted in the last bucket.
+	*/
+	class latency_histogram
+	{
+	public:
+		static constexpr std::size_t sub_bucket_bits = 3;
+		static constexpr std::size_t nb_sub_buckets = std::size_t(1) << sub_bucket_bits;
+		static constexpr std::size_t max_bits = 40;
+		static constexpr std::size_t nb_buckets = (max_bits - sub_bucket_bits + 1) * nb_sub_buckets;
+
+		// Index of the bucket counting a delay.
+		static constexpr std::size_t bucket_of(std::uint64_t ns) noexcept
+		{
+			ns = std::min<std::uint64_t>(ns, (std::uint64_t(1) << max_bits) - 1);
+			if (ns < nb_sub_buckets)
+				return static_cast<std::size_t>(ns);
+			const std::size_t msb = static_cast<std::size_t>(std::bit_width(ns)) - 1;
+			return (msb - sub_bucket_bits + 1) * nb_sub_buckets + static_cast<std::size_t>(ns >> (msb - sub_bucket_bits)) - nb_sub_buckets;
+		}
+
+		// Smallest delay counted by a bucket.
+		static constexpr std::uint64_t lower_bound(std::size_t bucket) noexcept
+		{
+			if (bucket < 2 * nb_sub_buckets)
+				return bucket;
+			return (nb_sub_buckets + bucket % nb_sub_buckets) << (bucket / nb_sub_buckets - 1);
+		}
+
+		// Biggest delay counted by a bucket.
+		static constexpr std::uint64_t upper_bound(std::size_t bucket) noexcept
+		{
+			return bucket + 1 < nb_buckets ? lower_bound(bucket + 1) - 1 : UINT64_MAX;
+		}
+
+		/**
+		* @brief Returns the number of recorded delays.
+		*/
+		std::uint64_t count() const noexcept;
+
+		/**
+		* @brief Returns the upper bound of the bucket of the delay at the given percentile (in [0, 100]), 0 if nothing was recorded.
+		*/
+		std::uint64_t value_at_percentile(double percentile) const noexcept;
+
+		std::array<std::uint64_t, nb_buckets> buckets{};	///< Number of delays recorded in each bucket.
+	};
+
+	/**
+	* @struct statistics
+	* @brief Snapshot of the instrumentation counters (see SISL_INSTRUMENTATION), summed over all the threads since the start of the program.
+	*/
+	struct statistics
+	{
+		struct thread_queue
+		{
+			std::thread::id thread_id;
+			std::size_t depth;				///< Calls pending in the queue of the thread.
+			latency_histogram latency;		///< Queueing delays of the calls invoked by the thread (pooled calls excluded).
+		};
+
+		std::uint64_t emits = 0;				///< Emissions of connected signals.
+		std::uint64_t direct_invocations = 0;	///< Slots invoked in the emitter's call.
+		std::uint64_t queued_posts = 0;			///< Calls posted to a thread, an event loop or the pool (queued, blocking_queued, pooled and idle slots).
+		std::uint64_t queued_invocations = 0;	///< Posted calls invoked by their receiver.
+		std::uint64_t queue_latency_ns = 0;		///< Sum of the enqueue-to-execution latencies of the queued invocations.
+		std::uint64_t max_queue_latency_ns = 0;	///< Worst enqueue-to-execution latency.
+		std::uint64_t blocking_waits = 0;		///< Emissions that waited for a blocking_queued slot.
+		std::uint64_t blocking_wait_ns = 0;		///< Time spent by the emitters waiting for blocking_queued slots.
+		std::uint64_t queue_full = 0;			///< Calls rejected by a full ring queue (see queue_full).
+		std::size_t pooled_depth = 0;			///< Pooled calls pending in the work pool.
+		std::vector<thread_queue> thread_queues;	///< Depth and latency histogram of each registered thread queue.
+	};
+
+	/**
+	* @brief Returns a snapshot of the instrumentation counters (only available with SISL_INSTRUMENTATION).
+	*
+	* The counters of the other threads are read without synchronization: the snapshot is consistent per counter, not across counters.
+	*/
+	statistics get_statistics();
+#endif // SISL_INSTRUMENTATION
+
+#ifdef SISL_TRACING
+	/**
+	* @brief Writes the trace events recorded by all the threads (see SISL_TRACING) in the Chrome trace JSON format.
+	*
+	* Can be called at any time from any thread, the threads keep tracing meanwhile (the events overwritten during the dump are skipped).
+	*/
+	void dump_trace(std::ostream& stream);
+
+	/**
+	* @brief Writes the trace events in a Chrome trace JSON file, to open with chrome://tracing or ui.perfetto.dev.
+	*
+	* @throws std::runtime_error if the file can't be written.
+	*/
+	void dump_trace(const std::string& file_path);
+
+	/**
+	* @brief Frees the trace buffers kept for the exited threads (see SISL_TRACE_MAX_EXITED_THREADS), their events are no longer dumped.
+	*/
+	void clear_exited_traces();
+#endif // SISL_TRACING
+
+#ifdef SISL_NUMA_AWARE
+	/**
+	* @brief Returns the number of memory chunks that could not be bound to their NUMA node (see SISL_NUMA_AWARE).
+	*
+	* A chunk whose mbind fails (no permission, offline node, ...) is still used, but its memory may be remote to the consumer.
+	*/
+	std::uint64_t numa_bind_failures() noexcept;
+#endif // SISL_NUMA_AWARE
+
 	#define __SISL_SIG_DEFINE(name, ...) SISL_NAMESPACE::signal<__VA_ARGS__> name;
 	#define __SISL_STR_DEFINE(x) #x
 	#define __SISL_STRINGIFY_DEFINE(x) __SISL_STR_DEFINE(x)
 	
+	namespace priv
+	{
+		// Removes the signal queue of an exited thread from the registry, if no running thread owns it.
+		void forget_thread_queue(std::thread::id thread_id);
+	}
+
 	/**
 	* @class sisl::jthread
 	* @brief Helper class that works like std::jthread but calls sisl::terminate(my_thread_id) on destruction.
+	* 
+	* Once joined, the signal queue of the thread is removed from SISL, even if the thread never polled it.
 	*/
 	class jthread
 	{
@@ -215,7 +577,17 @@ namespace SISL_NAMESPACE
 		template<typename... TARGS>
 		explicit jthread(TARGS&&... args)
 			: m_thread(std::forward<TARGS>(args)...) {}
-		~jthread() { sisl::terminate(get_id()); }
+		~jthread()
+		{
+			// A moved-from jthread has no thread (and an empty id would terminate all the threads)
+			if (!m_thread.joinable())
+				return;
+			const std::thread::id id = get_id();
+			sisl::terminate(id);
+			m_thread.request_stop();
+			m_thread.join();
+			priv::forget_thread_queue(id);
+		}
 
 		jthread(const jthread&) = delete;
 		jthread& operator=(const jthread&) = delete;
@@ -230,6 +602,99 @@ namespace SISL_NAMESPACE
 		std::jthread m_thread;
 	};
 
+	namespace priv
+	{
+		// Queue of slot invocations of a thread or of an event_loop (defined with the statics implementation).
+		struct async_delegates;
+	}
+
+	/**
+	* @class event_loop
+	* @brief A queue of slot invocations that is not bound to a thread.
+	*
+	* Queued connections can target an event_loop instead of a thread id: their calls are invoked by the thread polling the loop.
+	* Any thread can poll a loop (one at a time), so a loop can be moved to another thread without reconnecting anything.
+	* The thread polling a loop also takes the pooled calls (see type_connection::pooled).
+	* Calls queued to a terminated (or destroyed) loop are dropped, they never pile up.
+	*
+	* @code
+	* sisl::event_loop loop;
+	* sisl::connect(sig, receiver, &Receiver::on_value, loop, sisl::type_connection::queued);
+	* std::thread worker([&loop]() { while (loop.poll(sisl::blocking_polling) != sisl::polling_result::terminated) {} });
+	* @endcode
+	*/
+	class event_loop
+	{
+	public:
+		event_loop();
+
+		/**
+		* @brief Terminates the loop and drops its pending calls, the loop must not be polled anymore.
+		*/
+		~event_loop();
+
+		event_loop(const event_loop&) = delete;
+		event_loop& operator=(const event_loop&) = delete;
+
+		/**
+		* @brief Invokes the pending calls of the loop in the current thread, same as sisl::poll() for a thread.
+		*
+		* @throws invalid_concurrent_polling if another thread is polling the loop.
+		*/
+		polling_result poll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+		/**
+		* @brief Unlocks the thread polling the loop, the following calls to the loop's slots are dropped.
+		*/
+		void terminate();
+
+#ifdef __linux__
+		/**
+		* @brief Returns an eventfd readable while calls are pending for the loop, same as sisl::event_fd() for a thread (Linux only).
+		*
+		* The descriptor is closed when the loop is destroyed (and no emission is posting to it anymore).
+		*/
+		int event_fd();
+#endif // __linux__
+
+		/**
+		* @brief Returns the delay until the nearest timer of the loop, same as sisl::next_timer_delay() for a thread.
+		*/
+		std::chrono::milliseconds next_timer_delay();
+
+#ifdef SISL_INSTRUMENTATION
+		/**
+		* @brief Returns the histogram of the queueing delays of the calls invoked by the loop (see SISL_INSTRUMENTATION).
+		*/
+		latency_histogram get_queue_latency() const;
+#endif // SISL_INSTRUMENTATION
+
+	private:
+		friend class affinity;
+		std::shared_ptr<priv::async_delegates> m_sp_delegates;
+	};
+
+	/**
+	* @class affinity
+	* @brief Target of the queued calls of a connection: a thread (see sisl::poll) or an event_loop.
+	*
+	* Implicitly constructible from both, so the connect functions accept either. The default affinity is the thread of emission.
+	*/
+	class affinity
+	{
+	public:
+		affinity() = default;
+		affinity(std::thread::id thread_id) noexcept : m_thread_id(thread_id) {}
+		affinity(const event_loop& loop) noexcept : m_sp_loop(loop.m_sp_delegates) {}
+
+		std::thread::id get_thread_id() const noexcept { return m_thread_id; }
+		const std::shared_ptr<priv::async_delegates>& get_loop() const noexcept { return m_sp_loop; }
+
+	private:
+		std::thread::id m_thread_id;
+		std::shared_ptr<priv::async_delegates> m_sp_loop;
+	};
+
 	/**
 	 * @enum type_connection
 	 * @brief Defines the type of connection for signal-slot mechanisms.
@@ -243,6 +708,8 @@ namespace SISL_NAMESPACE
 		queued			= 2,			///< Enqueue slot to be invoked in the receiver's thread.
 		blocking_queued = 3,			///< Enqueue and block until the slot has finished, will throw an exception if the current thread is the same as the receiver's thread. 
 										//		<!> Can cause deadlocks with circular dependencies. <!>
+		pooled			= 4,			///< Enqueue slot in a work-stealing pool: invoked by any other thread inside sisl::poll() or event_loop::poll() (ignores thread affinity).
+		idle			= 5,			///< Enqueue slot in the idle lane of the receiver's thread: invoked by poll() only when no other call is pending.
 		unique			= 1<<6,			///< Prevent multiple connections to the same slot.
 		single_shot		= 1<<7,			///< Automatically disconnect after first trigger.
 	};
@@ -252,7 +719,8 @@ namespace SISL_NAMESPACE
 	}
 	constexpr bool is_type_connection_queued(type_connection type) noexcept
 	{
-		return get_type_connection_without_flags(type) == type_connection::queued || get_type_connection_without_flags(type) == type_connection::blocking_queued;
+		const type_connection type_without_flags = get_type_connection_without_flags(type);
+		return type_without_flags == type_connection::queued || type_without_flags == type_connection::blocking_queued || type_without_flags == type_connection::idle;
 	}
 	
 	namespace priv
@@ -387,6 +855,20 @@ namespace SISL_NAMESPACE
 		}
 		&& tuple_is_static_castable_v<typename function_traits<Function>::argument_types, TArgs...>;
 
+		// Payload of an emit_batch(): the argument itself for the signals with a single argument, a tuple of the arguments otherwise.
+		template<typename... TARGS>
+		struct batch_value { using type = std::tuple<std::remove_cvref_t<TARGS>...>; };
+
+		template<typename TARG>
+		struct batch_value<TARG> { using type = std::remove_cvref_t<TARG>; };
+
+		template<typename... TARGS>
+		using batch_value_t = typename batch_value<TARGS...>::type;
+
+		// Checks if TFUNCTOR can receive all the payloads of an emit_batch() at once (see connect_batch()).
+		template<typename TFUNCTOR, typename... TARGS>
+		concept COMPATIBLE_BATCH_FUNCTOR = std::is_invocable_v<std::decay_t<TFUNCTOR>&, std::span<const batch_value_t<TARGS...>>>;
+
 		template <typename T>
 		struct is_shared_ptr : std::false_type {};
 		template <typename T>
@@ -394,1031 +876,4753 @@ namespace SISL_NAMESPACE
 		template <typename T>
 		inline constexpr bool is_shared_ptr_v = is_shared_ptr<T>::value;
 
+		// Type of the receiver object (the managed type for a shared_ptr)
+		template <typename T>
+		struct receiver_type { using type = T; };
+		template <typename T>
+		struct receiver_type<std::shared_ptr<T>> { using type = T; };
+
 		inline std::thread::id get_empty_thread_id() noexcept { return std::thread::id(); }
-		struct delegate_info
-		{
-			void*			owner;			///< Pointer to the owner of the delegate (can be nullptr).
-			intptr_t		object;
-			std::size_t		function;
-			std::thread::id thread_affinity;
-			type_connection	type = automatic;
-		};
 
-		// We can't rely on std::function for delegate storage because perfect forwarding is not possible with it (and so causes undesired copies)
-		// So we build our own
-		template<typename TSIGNATURE, std::size_t STORAGE_SIZE = 64>
-		class delegate_impl;
+		// Unique address per type, a compile-time type identity that doesn't need RTTI.
+		template<typename T>
+		inline constexpr char type_tag = 0;
 
-		template<typename TRETURN, typename... TARGS, std::size_t STORAGE_SIZE>
-		class delegate_impl<TRETURN(TARGS...), STORAGE_SIZE>
+		// Only used to get the size of the most generic member function pointer (MSVC uses bigger pointers for classes with virtual/unknown inheritance).
+		struct undefined_class;
+
+		// Identity of a function (member function or C function) that doesn't rely on RTTI.
+		// It is made of the bytes of the function pointer plus a tag of its type: the bytes alone are not enough
+		// because methods of unrelated classes can share the same representation (e.g. virtual methods at the same vtable index).
+		class function_id
 		{
-		private:
-			alignas(std::max_align_t) std::array<std::byte, STORAGE_SIZE> m_storage{};
-			TRETURN(*m_invoker)(void* p_this, TARGS&&...) = nullptr;
-			void(*m_deleter)(void* p_this) = nullptr;
+		public:
+			constexpr function_id() noexcept = default;
 
-			template<typename TCALLABLE, typename... UARGS>
-			static TRETURN invoker(void* p_this, UARGS&&... args)
+			template<typename TFUNCTION>
+			static function_id of(TFUNCTION function) noexcept
 			{
-				return (*reinterpret_cast<TCALLABLE*>(p_this))(std::forward<UARGS>(args)...);
+				static_assert(sizeof(TFUNCTION) <= std::tuple_size_v<decltype(m_bytes)>, "[SISL] function_id: unsupported function pointer representation.");
+				function_id id;
+				id.m_type = &type_tag<TFUNCTION>;
+				std::memcpy(id.m_bytes.data(), &function, sizeof(TFUNCTION));
+				return id;
 			}
 
-			template<typename TCALLABLE>
-			static void deleter(void* p_this)
+			bool operator==(const function_id&) const noexcept = default;
+
+			// FNV-1a on the pointer bytes, seeded with the type tag.
+			std::size_t hash() const noexcept
 			{
-				reinterpret_cast<TCALLABLE*>(p_this)->~TCALLABLE();
+				std::size_t hash = static_cast<std::size_t>(14695981039346656037ull) ^ reinterpret_cast<std::uintptr_t>(m_type);
+				for (const std::byte byte : m_bytes)
+					hash = (hash ^ static_cast<std::size_t>(byte)) * static_cast<std::size_t>(1099511628211ull);
+				return hash;
 			}
 
-		public:
+		private:
+			const void* m_type = nullptr;
+			alignas(std::uintptr_t) std::array<std::byte, sizeof(void (undefined_class::*)())> m_bytes{};
+		};
 
-			delegate_impl() noexcept = default;
+		struct delegate_info
+		{
+			void*			owner;			///< Pointer to the owner of the delegate (can be nullptr).
+			intptr_t		object;			///< Address of the receiver object (0 for C functions).
+			function_id		function;		///< Identity of the connected method or C function (empty for functors).
+			std::thread::id thread_affinity;
+			type_connection	type = automatic;
+			std::weak_ptr<async_delegates> loop;		///< Event loop of the queued calls (weak: the calls pending in the loop hold their slot).
+			bool			targets_loop = false;	///< The calls go to loop instead of thread_affinity (dropped once the loop is destroyed).
+		};
 
-			template<typename TCALLABLE, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TCALLABLE>, delegate_impl>>>
-			delegate_impl(TCALLABLE&& callable)
-			{
-				new (m_storage.data()) TCALLABLE(std::forward<TCALLABLE>(callable));
-				m_invoker = &delegate_impl::invoker<TCALLABLE, TARGS...>;
-				m_deleter = &delegate_impl::deleter<TCALLABLE>;
-			}
+		// Identity of a slot (receiver object + function), used by unique connections and targeted disconnections.
+		struct slot_key
+		{
+			intptr_t		object;
+			function_id		function;
 
-			~delegate_impl()
-			{
-				m_deleter(m_storage.data());
-			}
+			bool operator==(const slot_key&) const noexcept = default;
+		};
 
-			TRETURN operator()(TARGS... args)
+		struct slot_key_hash
+		{
+			std::size_t operator()(const slot_key& key) const noexcept
 			{
-				return m_invoker(m_storage.data(), std::forward<TARGS>(args)...);
+				const std::size_t hash_object = std::hash<intptr_t>{}(key.object);
+				return hash_object ^ (key.function.hash() + 0x9e3779b9 + (hash_object << 6) + (hash_object >> 2));
 			}
 		};
 
-		template<typename... TARGS>
-		using delegate = delegate_impl<bool(TARGS...)>;
+		// Pooled heap storage for callables that don't fit in the inline storage of a delegate.
+		// Blocks are recycled by size class, so connecting/disconnecting big lambdas doesn't hit the allocator each time.
+		void* allocate_delegate_storage(std::size_t size);
+		void deallocate_delegate_storage(void* p_block, std::size_t size) noexcept;
 
-		template<typename... TARGS>
-		class slot
+#ifdef SISL_NUMA_AWARE
+		// Heap storage bound to a NUMA node (pooled by size class), a negative node uses the global allocator.
+		void* allocate_on_node(std::size_t size, int node);
+		void deallocate_on_node(void* p_block, std::size_t size, int node) noexcept;
+
+		// NUMA node of the CPU running the current thread.
+		int current_numa_node() noexcept;
+
+		// NUMA node of the thread (or event loop) consuming a queue, -1 if unknown.
+		int numa_node_of(std::thread::id thread_id);
+		int numa_node_of(const async_delegates& delegates) noexcept;
+
+		template<typename T>
+		struct numa_allocator
 		{
-		public:
-			slot(delegate<TARGS...>&& callee, const delegate_info& info)
-			{
-				m_callee = std::move(callee);
-				m_info = info;
-			}
+			using value_type = T;
+
+			explicit numa_allocator(int node) noexcept : node(alignof(T) <= std::hardware_constructive_interference_size ? node : -1) {}
 
-			slot(slot&& src) noexcept
+			template<typename U>
+			numa_allocator(const numa_allocator<U>& other) noexcept : node(other.node) {}
+
+			T* allocate(std::size_t n)
 			{
-				m_callee = std::move(src.m_callee);
-				m_info = src.m_info;
+				return static_cast<T*>(allocate_on_node(n * sizeof(T), node));
 			}
 
-			slot(const slot& src)
+			void deallocate(T* p, std::size_t n) noexcept
 			{
-				m_callee = src.m_callee;
-				m_info = src.m_info;
+				deallocate_on_node(p, n * sizeof(T), node);
 			}
 
-			const delegate_info& get_info() const
+			friend bool operator==(const numa_allocator& lhs, const numa_allocator& rhs) noexcept
 			{
-				return m_info;
+				return lhs.node == rhs.node;
 			}
 
-			inline bool operator()(TARGS... args)
-			{
-				return call_impl(args...);
+			int node;
+		};
+#endif // SISL_NUMA_AWARE
+
+		// We can't rely on std::function for delegate storage because perfect forwarding is not possible with it (and so causes undesired copies)
+		// So we build our own
+		// The callable is stored inline when it fits in STORAGE_SIZE, otherwise the inline storage holds a pointer to a pooled heap block.
+		// A delegate is neither copyable nor movable: it is built in place inside its slot (which is shared through shared_ptr).
+		template<typename TSIGNATURE, std::size_t STORAGE_SIZE = SISL_DELEGATE_STORAGE_SIZE>
+		class delegate_impl;
+
+		template<typename TRETURN, typename... TARGS, std::size_t STORAGE_SIZE>
+		class delegate_impl<TRETURN(TARGS...), STORAGE_SIZE>
+		{
+			static_assert(STORAGE_SIZE >= sizeof(void*), "[SISL] delegate_impl: the inline storage must be able to hold at least a pointer.");
+		private:
+			alignas(std::max_align_t) std::array<std::byte, STORAGE_SIZE> m_storage{};
+			TRETURN(*m_invoker)(void* p_storage, TARGS&&...) = nullptr;
+			void(*m_deleter)(void* p_storage) = nullptr;
+
+			template<typename TCALLABLE>
+			static constexpr bool is_stored_inline = sizeof(TCALLABLE) <= STORAGE_SIZE && alignof(TCALLABLE) <= alignof(std::max_align_t);
+
+			template<typename TCALLABLE>
+			static TCALLABLE* get(void* p_storage) noexcept
+			{
+				if constexpr (is_stored_inline<TCALLABLE>)
+					return std::launder(reinterpret_cast<TCALLABLE*>(p_storage));
+				else
+					return *reinterpret_cast<TCALLABLE**>(p_storage);
 			}
 
-			// Perfect forwarding for any type of arguments (lvalue, rvalue, const, non-const)
-			inline bool call_impl(TARGS... args)
+			template<typename TCALLABLE, typename... UARGS>
+			static TRETURN invoker(void* p_storage, UARGS&&... args)
+			{
+				return (*get<TCALLABLE>(p_storage))(std::forward<UARGS>(args)...);
+			}
+
+			template<typename TCALLABLE>
+			static void deleter(void* p_storage)
+			{
+				TCALLABLE* p_callable = get<TCALLABLE>(p_storage);
+				p_callable->~TCALLABLE();
+				if constexpr (!is_stored_inline<TCALLABLE>)
+				{
+					if constexpr (alignof(TCALLABLE) > alignof(std::max_align_t))
+						::operator delete(p_callable, std::align_val_t(alignof(TCALLABLE)));
+					else
+						deallocate_delegate_storage(p_callable, sizeof(TCALLABLE));
+				}
+			}
+
+		public:
+
+			delegate_impl() noexcept = default;
+
+			template<typename TCALLABLE, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TCALLABLE>, delegate_impl>>>
+			delegate_impl(TCALLABLE&& callable)
+			{
+				using callable_t = std::decay_t<TCALLABLE>;
+				if constexpr (is_stored_inline<callable_t>)
+				{
+					new (m_storage.data()) callable_t(std::forward<TCALLABLE>(callable));
+				}
+				else
+				{
+					void* p_block = nullptr;
+					if constexpr (alignof(callable_t) > alignof(std::max_align_t))
+						p_block = ::operator new(sizeof(callable_t), std::align_val_t(alignof(callable_t)));
+					else
+						p_block = allocate_delegate_storage(sizeof(callable_t));
+					try
+					{
+						*reinterpret_cast<callable_t**>(m_storage.data()) = new (p_block) callable_t(std::forward<TCALLABLE>(callable));
+					}
+					catch (...)
+					{
+						if constexpr (alignof(callable_t) > alignof(std::max_align_t))
+							::operator delete(p_block, std::align_val_t(alignof(callable_t)));
+						else
+							deallocate_delegate_storage(p_block, sizeof(callable_t));
+						throw;
+					}
+				}
+				m_invoker = &delegate_impl::invoker<callable_t, TARGS...>;
+				m_deleter = &delegate_impl::deleter<callable_t>;
+			}
+
+			delegate_impl(const delegate_impl&) = delete;
+			delegate_impl& operator=(const delegate_impl&) = delete;
+
+			~delegate_impl()
+			{
+				if (m_deleter)
+					m_deleter(m_storage.data());
+			}
+
+			TRETURN operator()(TARGS... args)
+			{
+				return m_invoker(m_storage.data(), std::forward<TARGS>(args)...);
+			}
+		};
+
+		template<std::size_t STORAGE_SIZE, typename... TARGS>
+		using delegate = delegate_impl<bool(TARGS...), STORAGE_SIZE>;
+
+		class slot_list_base;
+
+		template<typename TMUTEX>
+		class slot_list;
+
+		// Type-erased part of a slot: everything needed to manage a connection without knowing the signal's arguments.
+		class slot_base
+		{
+		public:
+			explicit slot_base(const delegate_info& info) : m_info(info) {}
+
+			slot_base(const slot_base&) = delete;
+			slot_base& operator=(const slot_base&) = delete;
+
+			const delegate_info& get_info() const
+			{
+				return m_info;
+			}
+
+			slot_key get_key() const noexcept
+			{
+				return { m_info.object, m_info.function };
+			}
+
+			// false once the slot has been removed from its signal (or once the signal is destroyed).
+			bool is_connected() const noexcept
+			{
+				return m_connected.load(std::memory_order_acquire);
+			}
+
+			// false once the receiver of the slot has been destroyed (see trackable), pending queued calls must be dropped.
+			// seq_cst: pairs with the publication of the hazard pointers (see receiver_guard).
+			bool is_receiver_alive() const noexcept
+			{
+				return m_receiver_alive.load(std::memory_order_seq_cst);
+			}
+
+			void invalidate_receiver() noexcept
+			{
+				m_receiver_alive.store(false, std::memory_order_seq_cst);
+			}
+
+			// The trackable receiver of the slot (nullptr if the receiver is not trackable), must be set before the slot is added to its list.
+			const void* get_tracker() const noexcept
+			{
+				return m_tracker;
+			}
+
+			void set_tracker(const void* p_tracker) noexcept
+			{
+				m_tracker = p_tracker;
+			}
+
+			// The list owning the slot, nullptr if the signal has been destroyed.
+			std::shared_ptr<slot_list_base> get_list() const noexcept
+			{
+				return m_list.lock();
+			}
+
+			// true if the slot receives the payloads of emit_batch() as a single span (see batch_slot).
+			bool accepts_batch() const noexcept
 			{
-				return m_callee(args...);
+				return m_accepts_batch;
 			}
 
-			delegate<TARGS...> m_callee;
 			delegate_info m_info;
+
+		protected:
+			bool m_accepts_batch = false;
+
+		private:
+			template<typename TMUTEX>
+			friend class slot_list;
+			std::weak_ptr<slot_list_base> m_list;
+			std::size_t m_index = 0;			///< Position in the owning list (protected by the list's mutex).
+			std::atomic_bool m_connected{ true };
+			std::atomic_bool m_receiver_alive{ true };
+			const void* m_tracker = nullptr;
 		};
 
-		// Function to enqueue a delegate for execution in a specific thread
-		void enqueue(std::function<void()>&& delegate, std::thread::id thread_id);
-	}
+		// Hazard pointers of a thread: the trackable receivers whose slots are being invoked by this thread.
+		// A trackable being destroyed waits until no other thread protects it, so a slot never runs on a destroyed receiver
+		// without paying a weak_ptr::lock() (two atomic RMW on a shared control block) per call: the hazard pointers are only written by their thread.
+		struct hazard_record
+		{
+			static constexpr std::size_t capacity = 16;
+
+			std::array<std::atomic<const void*>, capacity> hazards{};
+			std::size_t depth = 0;						///< Number of nested invocations (owner thread only).
+			std::mutex overflow_mtx;					///< Nested invocations deeper than capacity (slow path).
+			std::vector<const void*> overflow;
+			std::atomic_bool in_use{ true };
+			hazard_record* next = nullptr;
+		};
 
-	// forward declaration of signal class
-	template<typename...TARGS>
-	class signal;
+		// The hazard record of the current thread (created or recycled on first use).
+		hazard_record& get_hazard_record();
 
-	/**
-	* @brief Connects a member function to a member signal.
-	*
-	* @param owner Reference to the object owning the signal.
-	* @param signal Member address of the signal (exemple: &COwner::my_signal).
-	* @param instance Reference to the receiver object.
-	* @param method Pointer to the member function.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
-	void connect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, TINSTANCE& instance, TMETHOD method, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		(owner.*signal).connect(&owner, instance, method, thread_id, type);
-	}
+		// Blocks until no other thread protects p_tracker.
+		void wait_for_hazards(const void* p_tracker);
 
-	/**
-	* @brief Connects a member function to a standalone signal.
-	*
-	* @param signal Reference to the signal.
-	* @param instance Reference to the receiver object.
-	* @param method Pointer to the member function.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TINSTANCE, typename TMETHOD>
-	void connect(signal<TARGS...>& signal, TINSTANCE& instance, TMETHOD method, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		signal.connect(nullptr, instance, method, thread_id, type);
-	}
+		// Protects the receiver of a slot during its invocation, is_alive() must be checked before invoking the slot.
+		class receiver_guard
+		{
+		public:
+			explicit receiver_guard(const slot_base& slot)
+				: m_tracker(slot.get_tracker())
+			{
+				if (m_tracker)
+				{
+					m_record = &get_hazard_record();
+					if (m_record->depth < hazard_record::capacity)
+					{
+						m_record->hazards[m_record->depth].store(m_tracker, std::memory_order_seq_cst);
+					}
+					else
+					{
+						std::lock_guard lock(m_record->overflow_mtx);
+						m_record->overflow.push_back(m_tracker);
+					}
+					++m_record->depth;
+				}
+				m_alive = slot.is_receiver_alive();
+			}
 
-	/**
-	* @brief Connects a generic callable object (e.g. lambda, functor) to a member signal.
-	*
-	* @param owner Reference to the object owning the signal.
-	* @param signal Member address of the signal (exemple: &COwner::my_signal).
-	* @param functor Reference to the callable object.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TOWNER, typename TFUNCTOR>
-	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
-	void connect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, TFUNCTOR&& functor, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		(owner.*signal).connect(&owner, std::forward<TFUNCTOR>(functor), thread_id, type);
-	}
+			~receiver_guard()
+			{
+				if (!m_record)
+					return;
+				--m_record->depth;
+				if (m_record->depth < hazard_record::capacity)
+				{
+					m_record->hazards[m_record->depth].store(nullptr, std::memory_order_release);
+				}
+				else
+				{
+					std::lock_guard lock(m_record->overflow_mtx);
+					m_record->overflow.pop_back();
+				}
+			}
 
-	/**
-	* @brief Connects a generic callable object (e.g. lambda, functor) to a standalone signal.
-	*
-	* @param signal Reference to the signal.
-	* @param functor Reference to the callable object.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TFUNCTOR>
-	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
-	void connect(signal<TARGS...>& signal, TFUNCTOR&& functor, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		signal.connect(nullptr, std::forward<TFUNCTOR>(functor), thread_id, type);
-	}
+			receiver_guard(const receiver_guard&) = delete;
+			receiver_guard& operator=(const receiver_guard&) = delete;
 
-	/**
-	* @brief Connects a C/static function to a member signal.
-	*
-	* @param owner Reference to the object owning the signal.
-	* @param signal Member address of the signal (exemple: &COwner::my_signal).
-	* @param function Pointer to the function.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TOWNER, typename TFUNCTION>
-	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
-	void connect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, TFUNCTION&& function, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		(owner.*signal).connect(&owner, std::forward<TFUNCTION>(function), thread_id, type);
-	}
+			bool is_alive() const noexcept { return m_alive; }
 
-	/**
-	* @brief Connects a C/static function to a standalone signal.
-	*
-	* @param signal Reference to the signal.
-	* @param function Pointer to the function.
-	* @param thread_affinity Optional thread ID to specify the thread in which the slot should be executed (default will be the thread of emission).
-	* @param type Connection type (default is automatic).
-	*/
-	template<typename...TARGS, typename TFUNCTION>
-	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
-	void connect(signal<TARGS...>& signal, TFUNCTION&& function, std::thread::id thread_id = std::thread::id(), type_connection type = type_connection::automatic)
-	{
-		signal.connect(nullptr, std::forward<TFUNCTION>(function), thread_id, type);
-	}
+		private:
+			const void* m_tracker;
+			hazard_record* m_record = nullptr;
+			bool m_alive = true;
+		};
 
-	/**
-	* @brief Disconnects all slots connected to this member signal.
-	* 
-	* @param owner Reference to the object owning the signal
-	* @param signal Member address of the signal (exemple : &COwner::my_signal)
-	*/
-	template <typename...TARGS, typename TOWNER>
-	void disconnect_all(TOWNER& owner, signal<TARGS...> TOWNER::* signal)
-	{
-		(owner.*signal).disconnect_all();
-	}
+		// What a slot returns to its signal: false (or nullopt) if its receiver is dead and the slot must be removed,
+		// and the slot's result for the signals having a result type (see basic_signal::collect()).
+		template<typename TRESULT>
+		using slot_return_t = std::conditional_t<std::is_void_v<TRESULT>, bool, std::optional<TRESULT>>;
 
-	/**
-	* @brief Disconnects all slots connected to the signal.
-	* 
-	* @param signal Reference to the signal.
-	*/
-	template<typename...TARGS>
-	void disconnect_all(signal<TARGS...>& signal)
-	{
-		signal.disconnect_all();
-	}
+		inline bool is_slot_alive(bool returned) noexcept { return returned; }
 
-	/**
-	* @brief Disconnects a specific slot connected to this member signal.
-	* 
-	* @param owner Reference to the object owning the signal
-	* @param signal Member address of the signal (exemple : &COwner::my_signal)
-	* @param instance Reference to the receiver object.
-	* @param method Pointer to the member function.
-	*/
-	template<typename... TARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
-	void disconnect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, const TINSTANCE& instance, TMETHOD method)
-	{
-		(owner.*signal).disconnect(instance, method);
-	}
+		template<typename TRESULT>
+		bool is_slot_alive(const std::optional<TRESULT>& returned) noexcept { return returned.has_value(); }
+
+		// Calls the callable of a slot and returns the slot_return_t of its signal.
+		template<typename TRETURN, typename TCALL>
+		TRETURN call_slot(TCALL&& call)
+		{
+			if constexpr (std::is_same_v<TRETURN, bool>)
+			{
+				call();
+				return true; // Indicates successful call
+			}
+			else
+			{
+				static_assert(std::is_convertible_v<std::invoke_result_t<TCALL>, typename TRETURN::value_type>, "[SISL] connect(): The slot must return a value convertible to the result type of the signal.");
+				return TRETURN(std::in_place, call());
+			}
+		}
+
+		// Argument of a consumed payload (see slot::consume()): the value arguments are moved, the reference arguments are passed as is.
+		template<typename TARG, typename U>
+		decltype(auto) consume_arg(U& arg) noexcept
+		{
+			if constexpr (std::is_reference_v<TARG>)
+				return (arg);
+			else
+				return std::move(const_cast<std::remove_const_t<U>&>(arg));
+		}
+
+		// Passes the result of a slot (if any) to the combiner of the emission.
+		template<typename TSINK, typename TRETURN>
+		void forward_result(TSINK& sink, TRETURN&& returned)
+		{
+			if constexpr (!std::is_same_v<std::decay_t<TRETURN>, bool>)
+			{
+				if (returned)
+					sink(std::move(*returned));
+			}
+		}
+
+		template<std::size_t STORAGE_SIZE, typename TRETURN, typename... TARGS>
+		class slot : public slot_base
+		{
+		public:
+			template<typename TCALLABLE>
+			slot(TCALLABLE&& callee, const delegate_info& info)
+				: slot_base(info), m_callee(std::forward<TCALLABLE>(callee))
+			{
+			}
+
+			inline TRETURN operator()(TARGS... args)
+			{
+				return call_impl(args...);
+			}
+
+			// Perfect forwarding for any type of arguments (lvalue, rvalue, const, non-const)
+			inline TRETURN call_impl(TARGS... args)
+			{
+				return m_callee(false, args...);
+			}
+
+			// Invokes the slot with a payload owned by the call (the only receiver of an emission):
+			// the value arguments reference non-const objects, they are moved to the callable.
+			inline TRETURN consume(TARGS... args)
+			{
+				return m_callee(true, args...);
+			}
+
+			delegate_impl<TRETURN(bool, TARGS...), STORAGE_SIZE> m_callee;
+		};
+
+		// Slot receiving all the payloads of an emit_batch() in one call (see connect_batch()), a single emission is passed as a span of one payload.
+		template<std::size_t STORAGE_SIZE, typename TBATCH, typename... TARGS>
+		class batch_slot : public slot<STORAGE_SIZE, bool, TARGS...>
+		{
+		public:
+			template<typename TCALLABLE>
+			batch_slot(TCALLABLE&& callee, const delegate_info& info)
+				: slot<STORAGE_SIZE, bool, TARGS...>([this](bool, TARGS... args) -> bool { call_single(args...); return true; }, info)
+				, m_batch_callee(std::forward<TCALLABLE>(callee))
+			{
+				this->m_accepts_batch = true;
+			}
+
+			inline void call_batch(std::span<const TBATCH> batch)
+			{
+				m_batch_callee(std::move(batch));
+			}
+
+		private:
+			void call_single(TARGS... args)
+			{
+				if constexpr (sizeof...(TARGS) == 1)
+				{
+					call_batch(std::span<const TBATCH>(std::addressof(args...), 1));
+				}
+				else
+				{
+					const TBATCH value(args...);
+					call_batch(std::span<const TBATCH>(&value, 1));
+				}
+			}
+
+			delegate_impl<void(std::span<const TBATCH>), STORAGE_SIZE> m_batch_callee;
+		};
+
+		// Sinks of the results of an emission (see basic_signal::collect()).
+		// An emission without combiner discards the results.
+		struct no_combiner
+		{
+			template<typename T>
+			void operator()(T&&) const noexcept {}
+
+			no_combiner queued_receiver(type_connection) const noexcept { return {}; }
+		};
+
+		// Receives the result of a queued call for a collect(): only the blocking_queued calls are combined (the emitter waits for them).
+		template<typename TCOMBINER>
+		struct combiner_ref
+		{
+			template<typename T>
+			void operator()(T&& value)
+			{
+				if (p_combiner)
+					(*p_combiner)(std::forward<T>(value));
+			}
+
+			TCOMBINER* p_combiner;
+		};
+
+		// collect(): the results are combined by the emitter, or by the receiver of a blocking_queued call while the emitter waits (no lock needed).
+		template<typename TCOMBINER>
+		struct sync_collector
+		{
+			template<typename T>
+			void operator()(T&& value)
+			{
+				combiner(std::forward<T>(value));
+			}
+
+			combiner_ref<TCOMBINER> queued_receiver(type_connection type) noexcept
+			{
+				return { type == type_connection::blocking_queued ? &combiner : nullptr };
+			}
+
+			TCOMBINER& combiner;
+		};
+
+		template<typename TCOMBINER>
+		using combiner_result_t = std::decay_t<decltype(std::declval<TCOMBINER&>().result())>;
+
+		// collect_async(): state shared by an emission and its queued calls, the result is set once all of them have released it
+		// (the queued calls release it when they are invoked or dropped).
+		template<typename TCOMBINER>
+		struct async_collect_state
+		{
+			explicit async_collect_state(TCOMBINER&& combiner)
+				: m_combiner(std::move(combiner))
+			{
+			}
+
+			~async_collect_state()
+			{
+				try
+				{
+					m_promise.set_value(m_combiner.result());
+				}
+				catch (...)
+				{
+					m_promise.set_exception(std::current_exception());
+				}
+			}
+
+			template<typename T>
+			void operator()(T&& value)
+			{
+				std::lock_guard lock(m_mtx);
+				m_combiner(std::forward<T>(value));
+			}
+
+			TCOMBINER m_combiner;
+			std::mutex m_mtx;
+			std::promise<combiner_result_t<TCOMBINER>> m_promise;
+		};
+
+		template<typename TCOMBINER>
+		struct async_collector
+		{
+			template<typename T>
+			void operator()(T&& value)
+			{
+				(*sp_state)(std::forward<T>(value));
+			}
+
+			async_collector queued_receiver(type_connection) const noexcept { return *this; }
+
+			std::shared_ptr<async_collect_state<TCOMBINER>> sp_state;
+		};
+
+		// Locks a list for reading: shared if the mutex supports it, exclusive otherwise (std::mutex, spin_mutex).
+		template<typename TMUTEX>
+		concept SHARED_LOCKABLE = requires(TMUTEX& mtx) { mtx.lock_shared(); mtx.unlock_shared(); };
+
+		template<typename TMUTEX>
+		using read_lock = std::conditional_t<SHARED_LOCKABLE<TMUTEX>, std::shared_lock<TMUTEX>, std::unique_lock<TMUTEX>>;
+
+#ifdef SISL_INSTRUMENTATION
+		// Stripe of the per-signal counters written by the current thread: the threads take the stripes in turn.
+		std::size_t local_counter_stripe() noexcept;
+#endif // SISL_INSTRUMENTATION
+
+		// Type-erased part of a slots list (its mutex type depends on the signal's policy), used by the connection handles and the trackable receivers.
+		// The list owns itself: its signal only keeps a raw pointer on it (one word) and gives up the ownership with release().
+		// Connection handles may still use the list after that, until their last weak_ptr::lock() is released.
+		class slot_list_base : public std::enable_shared_from_this<slot_list_base>
+		{
+		public:
+			virtual ~slot_list_base() = default;
+
+			virtual bool remove(slot_base& slot) = 0;
+
+			void release() noexcept
+			{
+				std::shared_ptr<slot_list_base> sp_self = std::move(m_self);
+			}
+
+#ifdef SISL_INSTRUMENTATION
+			// The emissions are counted in the stripe of the emitter thread: the emitters of a hot signal don't share a cache line.
+			void count_emit(std::uint64_t nb_emits = 1) noexcept
+			{
+				m_emit_stripes[local_counter_stripe()].count.fetch_add(nb_emits, std::memory_order_relaxed);
+			}
+
+			std::uint64_t get_nb_emits() const noexcept
+			{
+				std::uint64_t nb_emits = 0;
+				for (const auto& stripe : m_emit_stripes)
+					nb_emits += stripe.count.load(std::memory_order_relaxed);
+				return nb_emits;
+			}
+
+			static constexpr std::size_t nb_counter_stripes = 16;
+#endif // SISL_INSTRUMENTATION
+
+		protected:
+			std::shared_ptr<slot_list_base> m_self;	///< Ownership of the signal (see release()).
+#ifdef SISL_INSTRUMENTATION
+			struct alignas(std::hardware_constructive_interference_size) emit_stripe
+			{
+				std::atomic<std::uint64_t> count{ 0 };
+			};
+			std::array<emit_stripe, nb_counter_stripes> m_emit_stripes;
+#endif // SISL_INSTRUMENTATION
+		};
+
+		// Storage of the slots connected to a signal.
+		// Removing a slot only leaves a hole (nullptr) at its position, holes are reclaimed by a compaction once
+		// they exceed half of the storage. So removing a slot is O(1) (amortized) and the emission order stays the connection order.
+		// Removed slots are always released after the mutex is unlocked (their destruction may re-enter the signal).
+		// A hash index on slot_key is built on the first keyed operation (unique connection or disconnection of an instance's method),
+		// then maintained, so lists that never use it don't pay its memory.
+		template<typename TMUTEX>
+		class slot_list final : public slot_list_base
+		{
+		public:
+			static slot_list* create()
+			{
+				auto sp_list = std::make_shared<slot_list>();
+				sp_list->m_self = sp_list;
+				return sp_list.get();
+			}
+
+			~slot_list()
+			{
+				for (const auto& sp_slot : m_slots)
+				{
+					if (sp_slot)
+						sp_slot->m_connected.store(false, std::memory_order_release);
+				}
+			}
+
+			// Adds a slot, if unique is true and a slot with the same key is already connected, the existing slot is returned instead.
+			std::shared_ptr<slot_base> add(std::shared_ptr<slot_base> sp_slot, bool unique)
+			{
+				sp_slot->m_list = weak_from_this();
+				const slot_key key = sp_slot->get_key();
+				std::unique_lock lock(m_mtx);
+				if (unique)
+				{
+					build_index_if_necessary();
+					const auto it = m_index->find(key);
+					if (it != m_index->end())
+						return m_slots[it->second->m_index];
+				}
+				if (m_index)
+					m_index->emplace(key, sp_slot.get());
+				sp_slot->m_index = m_slots.size();
+				m_slots.emplace_back(sp_slot);
+				return sp_slot;
+			}
+
+			bool remove(slot_base& slot) override
+			{
+				std::shared_ptr<slot_base> sp_removed;
+				std::unique_lock lock(m_mtx);
+				sp_removed = remove_locked(slot);
+				compact_if_necessary();
+				return sp_removed != nullptr;
+			}
+
+			template<typename TPREDICATE>
+			void remove_if(TPREDICATE&& predicate)
+			{
+				std::vector<std::shared_ptr<slot_base>> removed;
+				std::unique_lock lock(m_mtx);
+				for (const auto& sp_slot : m_slots)
+				{
+					if (sp_slot && predicate(*sp_slot))
+						removed.emplace_back(remove_locked(*sp_slot));
+				}
+				compact_if_necessary();
+			}
+
+			// Removes all the slots with the given key in O(k) (k = number of slots with this key).
+			void remove(const slot_key& key)
+			{
+				std::vector<std::shared_ptr<slot_base>> removed;
+				std::unique_lock lock(m_mtx);
+				build_index_if_necessary();
+				const auto [first, last] = m_index->equal_range(key);
+				for (auto it = first; it != last; ++it)
+					removed.emplace_back(m_slots[it->second->m_index]);
+				for (const auto& sp_slot : removed)
+					remove_locked(*sp_slot);
+				compact_if_necessary();
+			}
+
+			void clear()
+			{
+				std::vector<std::shared_ptr<slot_base>> removed;
+				std::unique_lock lock(m_mtx);
+				for (const auto& sp_slot : m_slots)
+				{
+					if (sp_slot)
+						sp_slot->m_connected.store(false, std::memory_order_release);
+				}
+				removed.swap(m_slots);
+				m_nb_holes = 0;
+				if (m_index)
+					m_index->clear();
+			}
+
+			// Copies the connected slots, the copy is iterated without holding the lock (smaller contention, and slots can re-enter the signal).
+			void snapshot(std::vector<std::shared_ptr<slot_base>>& slots) const
+			{
+				read_lock<TMUTEX> lock(m_mtx);
+				slots.reserve(m_slots.size() - m_nb_holes);
+				for (const auto& sp_slot : m_slots)
+				{
+					if (sp_slot)
+						slots.push_back(sp_slot);
+				}
+			}
+
+		private:
+			std::shared_ptr<slot_base> remove_locked(slot_base& slot)
+			{
+				if (!slot.m_connected.load(std::memory_order_relaxed))
+					return nullptr;
+				slot.m_connected.store(false, std::memory_order_release);
+				++m_nb_holes;
+				if (m_index)
+				{
+					const auto [first, last] = m_index->equal_range(slot.get_key());
+					for (auto it = first; it != last; ++it)
+					{
+						if (it->second == &slot)
+						{
+							m_index->erase(it);
+							break;
+						}
+					}
+				}
+				return std::move(m_slots[slot.m_index]);
+			}
+
+			void build_index_if_necessary()
+			{
+				if (m_index)
+					return;
+				m_index = std::make_unique<std::unordered_multimap<slot_key, slot_base*, slot_key_hash>>();
+				m_index->reserve(m_slots.size() - m_nb_holes);
+				for (const auto& sp_slot : m_slots)
+				{
+					if (sp_slot)
+						m_index->emplace(sp_slot->get_key(), sp_slot.get());
+				}
+			}
+
+			void compact_if_necessary()
+			{
+				if (m_nb_holes * 2 <= m_slots.size())
+					return;
+				std::size_t index = 0;
+				for (std::size_t i = 0; i < m_slots.size(); ++i)
+				{
+					if (!m_slots[i])
+						continue;
+					m_slots[i]->m_index = index;
+					if (i != index)
+						m_slots[index] = std::move(m_slots[i]);
+					++index;
+				}
+				m_slots.resize(index);
+				m_nb_holes = 0;
+			}
+
+			std::vector<std::shared_ptr<slot_base>> m_slots;
+			std::size_t m_nb_holes = 0;
+			std::unique_ptr<std::unordered_multimap<slot_key, slot_base*, slot_key_hash>> m_index;
+			mutable TMUTEX m_mtx;
+		};
+
+#ifdef SISL_INSTRUMENTATION
+		using stats_clock = std::chrono::steady_clock;
+
+		// Instrumentation counters of a thread: only written by the thread itself (relaxed load + store, no atomic read-modify-write),
+		// read by get_statistics().
+		struct thread_statistics
+		{
+			enum counter : std::size_t
+			{
+				emits,
+				direct_invocations,
+				queued_posts,
+				queued_invocations,
+				queue_latency_ns,
+				blocking_waits,
+				blocking_wait_ns,
+				queue_full,
+				nb_counters
+			};
+
+			void add(counter c, std::uint64_t value) noexcept
+			{
+				m_counters[c].store(m_counters[c].load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+
+			void add_elapsed(counter c, stats_clock::time_point since) noexcept
+			{
+				add(c, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stats_clock::now() - since).count()));
+			}
+
+			void add_queued_invocation(std::uint64_t latency) noexcept
+			{
+				add(queued_invocations, 1);
+				add(queue_latency_ns, latency);
+				if (latency > m_max_queue_latency_ns.load(std::memory_order_relaxed))
+					m_max_queue_latency_ns.store(latency, std::memory_order_relaxed);
+			}
+
+			std::array<std::atomic<std::uint64_t>, nb_counters> m_counters{};
+			std::atomic<std::uint64_t> m_max_queue_latency_ns{ 0 };
+		};
+
+		// Counters of the current thread.
+		thread_statistics& local_statistics();
+#endif // SISL_INSTRUMENTATION
+
+#ifdef SISL_TRACING
+		enum class trace_event : std::uint8_t
+		{
+			emit_begin,
+			emit_end,
+			enqueue,
+			dequeue,
+			slot_begin,
+			slot_end,
+		};
+
+		// What a queued call carries to trace its dequeue and its invocation in the receiver thread.
+		struct trace_context
+		{
+			std::uint64_t flow_id = 0;			///< Links the enqueue event to the dequeue event (0: not traced).
+			const void* signal = nullptr;
+			const void* owner = nullptr;
+			type_connection type = type_connection::automatic;
+		};
+
+		// Records an event in the trace buffer of the current thread.
+		void trace(trace_event event, const void* signal, const void* owner, type_connection type, std::uint64_t flow_id = 0) noexcept;
+
+		// Returns a new flow id, unique among all the threads.
+		std::uint64_t next_trace_flow_id() noexcept;
+
+		// Records the begin and the end of an emission or a slot invocation (even if it throws).
+		struct trace_scope
+		{
+			trace_scope(trace_event begin, const void* signal, const void* owner, type_connection type) noexcept
+				: m_end(begin == trace_event::emit_begin ? trace_event::emit_end : trace_event::slot_end), m_signal(signal), m_owner(owner), m_type(type)
+			{
+				trace(begin, signal, owner, type);
+			}
+			~trace_scope() { trace(m_end, m_signal, m_owner, m_type); }
+
+			trace_scope(const trace_scope&) = delete;
+			trace_scope& operator=(const trace_scope&) = delete;
+
+			trace_event m_end;
+			const void* m_signal;
+			const void* m_owner;
+			type_connection m_type;
+		};
+#endif // SISL_TRACING
+
+		// std allocator adapter of an allocator (see SISL_ALLOCATOR), for the objects managed by shared_ptr.
+		template<typename T, typename TALLOCATOR>
+		struct std_allocator
+		{
+			using value_type = T;
+
+			std_allocator() noexcept = default;
+
+			template<typename U>
+			std_allocator(const std_allocator<U, TALLOCATOR>&) noexcept {}
+
+			T* allocate(std::size_t n)
+			{
+				return static_cast<T*>(TALLOCATOR::allocate(n * sizeof(T), alignof(T)));
+			}
+
+			void deallocate(T* p, std::size_t n) noexcept
+			{
+				TALLOCATOR::deallocate(p, n * sizeof(T), alignof(T));
+			}
+
+			friend bool operator==(const std_allocator&, const std_allocator&) noexcept
+			{
+				return true;
+			}
+		};
+
+		// Move-only callable of a queued call. Unlike std::function, the captures are never copied,
+		// and the callables that don't fit in the inline storage are allocated by SISL_ALLOCATOR.
+		class task
+		{
+		public:
+			static constexpr std::size_t inline_size = 64;
+
+			task() noexcept = default;
+
+			template<typename TCALLABLE>
+			requires (!std::is_same_v<std::decay_t<TCALLABLE>, task> && !std::is_same_v<std::decay_t<TCALLABLE>, std::nullptr_t>)
+			task(TCALLABLE&& callable)
+			{
+				using callable_type = std::decay_t<TCALLABLE>;
+				if constexpr (fits_inline<callable_type>)
+				{
+					new (m_storage) callable_type(std::forward<TCALLABLE>(callable));
+					m_p_operations = &inline_operations<callable_type>;
+				}
+				else
+				{
+					void* p_block = SISL_ALLOCATOR::allocate(sizeof(callable_type), alignof(callable_type));
+					try
+					{
+						*reinterpret_cast<callable_type**>(m_storage) = new (p_block) callable_type(std::forward<TCALLABLE>(callable));
+					}
+					catch (...)
+					{
+						SISL_ALLOCATOR::deallocate(p_block, sizeof(callable_type), alignof(callable_type));
+						throw;
+					}
+					m_p_operations = &heap_operations<callable_type>;
+				}
+			}
+
+			task(task&& other) noexcept
+			{
+				move_from(other);
+			}
+
+			task& operator=(task&& other) noexcept
+			{
+				if (this != &other)
+				{
+					reset();
+					move_from(other);
+				}
+				return *this;
+			}
+
+			task& operator=(std::nullptr_t) noexcept
+			{
+				reset();
+				return *this;
+			}
+
+			~task()
+			{
+				reset();
+			}
+
+			void operator()()
+			{
+				m_p_operations->invoke(m_storage);
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return m_p_operations != nullptr;
+			}
+
+		private:
+			struct operations
+			{
+				void (*invoke)(void* p_storage);
+				void (*move)(void* p_destination, void* p_source) noexcept;	///< Moves the callable, and destroys the source.
+				void (*destroy)(void* p_storage) noexcept;
+			};
+
+			template<typename T>
+			static constexpr bool fits_inline = sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<T>;
+
+			template<typename T>
+			static constexpr operations inline_operations =
+			{
+				[](void* p_storage) { (*static_cast<T*>(p_storage))(); },
+				[](void* p_destination, void* p_source) noexcept { new (p_destination) T(std::move(*static_cast<T*>(p_source))); static_cast<T*>(p_source)->~T(); },
+				[](void* p_storage) noexcept { static_cast<T*>(p_storage)->~T(); }
+			};
+
+			template<typename T>
+			static constexpr operations heap_operations =
+			{
+				[](void* p_storage) { (**static_cast<T**>(p_storage))(); },
+				[](void* p_destination, void* p_source) noexcept { *static_cast<T**>(p_destination) = *static_cast<T**>(p_source); },
+				[](void* p_storage) noexcept
+				{
+					T* p_callable = *static_cast<T**>(p_storage);
+					p_callable->~T();
+					SISL_ALLOCATOR::deallocate(p_callable, sizeof(T), alignof(T));
+				}
+			};
+
+			void move_from(task& other) noexcept
+			{
+				if (other.m_p_operations)
+				{
+					other.m_p_operations->move(m_storage, other.m_storage);
+					m_p_operations = std::exchange(other.m_p_operations, nullptr);
+				}
+			}
+
+			void reset() noexcept
+			{
+				if (m_p_operations)
+					std::exchange(m_p_operations, nullptr)->destroy(m_storage);
+			}
+
+			alignas(std::max_align_t) std::byte m_storage[inline_size];
+			const operations* m_p_operations = nullptr;
+		};
+
+		// A call posted to a queue (or to the work pool).
+		struct queued_call
+		{
+			task delegate;
+#ifdef SISL_INSTRUMENTATION
+			stats_clock::time_point enqueued_at;	///< Measured when the call is invoked (see latency_recorder).
+#endif // SISL_INSTRUMENTATION
+#ifdef SISL_TRACING
+			trace_context trace;
+#endif // SISL_TRACING
+
+			queued_call() = default;
+			explicit queued_call(task&& delegate)
+				: delegate(std::move(delegate))
+#ifdef SISL_INSTRUMENTATION
+				, enqueued_at(stats_clock::now())
+#endif // SISL_INSTRUMENTATION
+			{
+			}
+		};
+
+		// Function to enqueue a delegate for execution in a specific thread (in its idle lane if idle is true, see type_connection::idle)
+		void enqueue(queued_call&& call, std::thread::id thread_id, bool idle = false);
+
+		// Function to enqueue a delegate for execution in an event loop, returns false if the loop is terminated (the delegate is dropped).
+		bool enqueue(queued_call&& call, async_delegates& loop, bool idle = false);
+
+		// Function to enqueue a delegate for execution by any polling thread (see type_connection::pooled).
+		void enqueue_pooled(queued_call&& call);
+	}
+
+	// Instrumentation hooks of the hot paths, they compile to nothing without SISL_INSTRUMENTATION.
+#ifdef SISL_INSTRUMENTATION
+	#define __SISL_STATS_ADD(counter, value) SISL_NAMESPACE::priv::local_statistics().add(SISL_NAMESPACE::priv::thread_statistics::counter, value)
+	#define __SISL_STATS_NOW(name) const SISL_NAMESPACE::priv::stats_clock::time_point name = SISL_NAMESPACE::priv::stats_clock::now()
+	#define __SISL_STATS_ADD_ELAPSED(counter, since) SISL_NAMESPACE::priv::local_statistics().add_elapsed(SISL_NAMESPACE::priv::thread_statistics::counter, since)
+#else
+	#define __SISL_STATS_ADD(counter, value)
+	#define __SISL_STATS_NOW(name)
+	#define __SISL_STATS_ADD_ELAPSED(counter, since)
+#endif // SISL_INSTRUMENTATION
+
+	// Tracing hooks (see SISL_TRACING), they compile to nothing without it.
+#ifdef SISL_TRACING
+	#define __SISL_TRACE_SCOPE(name, begin, signal, owner, type) const SISL_NAMESPACE::priv::trace_scope name(SISL_NAMESPACE::priv::trace_event::begin, signal, owner, type)
+	#define __SISL_TRACE_ENQUEUE(call, signal, owner, type) \
+		call.trace = { SISL_NAMESPACE::priv::next_trace_flow_id(), signal, owner, type }; \
+		SISL_NAMESPACE::priv::trace(SISL_NAMESPACE::priv::trace_event::enqueue, signal, owner, type, call.trace.flow_id)
+#else
+	#define __SISL_TRACE_SCOPE(name, begin, signal, owner, type)
+	#define __SISL_TRACE_ENQUEUE(call, signal, owner, type)
+#endif // SISL_TRACING
+
+	/**
+	* @struct slow_slot_report
+	* @brief A slot invocation that lasted longer than the threshold of the slow slot detector (see sisl::set_slow_slot_handler()).
+	*/
+	struct slow_slot_report
+	{
+		const void* signal;					///< Address of the emitted signal.
+		void* sender;						///< Owner of the signal given to connect (nullptr if none).
+		const void* receiver;				///< Receiver object of a method slot (nullptr for functions).
+		std::thread::id thread_affinity;	///< Thread affinity of the connection.
+		type_connection type;				///< Type of the connection (with its flags).
+		std::chrono::nanoseconds duration;	///< Duration of the invocation.
+	};
+
+	/**
+	* @brief Installs the slow slot detector: the slot invocations (direct or queued) lasting longer than threshold are reported to handler.
+	*
+	* The handler is called in the thread that invoked the slot, right after the slot returned (a slot that throws or never returns is not reported),
+	* its exceptions propagate like the ones of the slot. An empty handler (or a zero threshold) disables the detector.
+	* While disabled, the detector costs a relaxed load per slot invocation.
+	*
+	* @code
+	* sisl::set_slow_slot_handler(std::chrono::milliseconds(5), [](const sisl::slow_slot_report& report)
+	* {
+	*     std::cerr << "slot of " << report.signal << " took " << report.duration.count() << "ns\n";
+	* });
+	* @endcode
+	*/
+	void set_slow_slot_handler(std::chrono::nanoseconds threshold, std::function<void(const slow_slot_report&)> handler);
+
+	/**
+	* @class connection
+	* @brief Lightweight handle on a connection between a signal and a slot.
+	*
+	* Returned by sisl::connect(), it allows to disconnect this specific slot in O(1) without searching it in the signal.
+	* The handle doesn't own the connection: destroying it keeps the slot connected (see scoped_connection).
+	* It stays valid (but disconnected) if the signal is destroyed.
+	*/
+	class connection
+	{
+	public:
+		connection() noexcept = default;
+
+		/**
+		* @brief Disconnects the slot from its signal (does nothing if already disconnected).
+		*/
+		void disconnect() const
+		{
+			if (auto sp_slot = m_slot.lock())
+			{
+				if (auto sp_list = sp_slot->get_list())
+					sp_list->remove(*sp_slot);
+			}
+		}
+
+		/**
+		* @brief Returns true if the slot is still connected to its signal.
+		*/
+		bool connected() const noexcept
+		{
+			const auto sp_slot = m_slot.lock();
+			return sp_slot && sp_slot->is_connected();
+		}
+
+		explicit operator bool() const noexcept { return connected(); }
+
+	private:
+		template<typename, typename...>
+		friend class basic_signal;
+
+		explicit connection(std::weak_ptr<priv::slot_base> slot) noexcept : m_slot(std::move(slot)) {}
+
+		std::weak_ptr<priv::slot_base> m_slot;
+	};
+
+	/**
+	* @class scoped_connection
+	* @brief RAII connection handle: disconnects the slot when destroyed.
+	*
+	* @code
+	* sisl::scoped_connection connection = sisl::connect(button, &MyButton::onClick, widget, &MyWidget::onButtonClick);
+	* @endcode
+	*/
+	class scoped_connection : public connection
+	{
+	public:
+		scoped_connection() noexcept = default;
+		scoped_connection(const connection& other) noexcept : connection(other) {}
+		~scoped_connection() { disconnect(); }
+
+		scoped_connection(const scoped_connection&) = delete;
+		scoped_connection& operator=(const scoped_connection&) = delete;
+		scoped_connection(scoped_connection&& other) noexcept = default;
+		scoped_connection& operator=(scoped_connection&& other) noexcept
+		{
+			if (this != &other)
+			{
+				disconnect();
+				connection::operator=(std::move(other));
+			}
+			return *this;
+		}
+
+		/**
+		* @brief Releases the ownership of the connection: the slot stays connected after the destruction of this object.
+		*/
+		connection release() noexcept
+		{
+			connection released = *this;
+			connection::operator=(connection());
+			return released;
+		}
+	};
+
+	namespace priv
+	{
+		// A delayed or periodic emission (see basic_signal::emit_after()), fired inside poll() by the thread polling its queue.
+		struct timer_state
+		{
+			timer_state(task&& fire, std::weak_ptr<slot_list_base> wp_slots, std::chrono::steady_clock::duration period)
+				: m_fire(std::move(fire)), m_wp_slots(std::move(wp_slots)), m_period(period)
+			{
+			}
+
+			bool is_active() const noexcept
+			{
+				return !m_cancelled.load(std::memory_order_acquire) && !m_wp_slots.expired();
+			}
+
+			task m_fire;										///< Emits the stored arguments.
+			std::weak_ptr<slot_list_base> m_wp_slots;			///< Slots of the signal: the timer stops when its signal is destroyed.
+			const std::chrono::steady_clock::duration m_period;	///< Zero for a single emission.
+			std::atomic_bool m_cancelled{ false };
+		};
+
+		// Schedules a timer in the queue polled by the current thread: the event loop it is polling, or its own queue.
+		void schedule_timer(std::shared_ptr<timer_state> sp_timer, std::chrono::steady_clock::duration delay);
+	}
+
+	/**
+	* @class timer
+	* @brief Handle on a delayed or periodic emission (see basic_signal::emit_after() and basic_signal::emit_every()).
+	*
+	* The handle doesn't own the timer: destroying it keeps the emission scheduled.
+	*/
+	class timer
+	{
+	public:
+		timer() noexcept = default;
+
+		/**
+		* @brief Cancels the next emissions of the timer (does nothing if the timer is already over), can be called from any thread.
+		*/
+		void cancel() const noexcept
+		{
+			if (auto sp_timer = m_timer.lock())
+				sp_timer->m_cancelled.store(true, std::memory_order_release);
+		}
+
+		/**
+		* @brief Returns true while the timer has emissions left: not fired yet (or periodic), not cancelled and its signal is alive.
+		*/
+		bool active() const noexcept
+		{
+			const auto sp_timer = m_timer.lock();
+			return sp_timer && sp_timer->is_active();
+		}
+
+		explicit operator bool() const noexcept { return active(); }
+
+	private:
+		template<typename, typename...>
+		friend class basic_signal;
+
+		explicit timer(std::weak_ptr<priv::timer_state> timer) noexcept : m_timer(std::move(timer)) {}
+
+		std::weak_ptr<priv::timer_state> m_timer;
+	};
+
+	/**
+	* @class trackable
+	* @brief Base class for receivers whose slots are automatically disconnected when they are destroyed.
+	*
+	* A trackable receiver records the slots connected to its methods, its destruction disconnects exactly these slots
+	* (in O(k) for k connections) and drops their pending queued calls. Unlike the std::enable_shared_from_this mechanism,
+	* it works for receivers that are not managed by std::shared_ptr and dead receivers are removed immediately (not on the next emission).
+	*
+	* @code
+	* class MyWidget : public sisl::trackable { ... };
+	* @endcode
+	*/
+	class trackable
+	{
+	public:
+		trackable() = default;
+
+		/**
+		* @brief The copy of a trackable does not copy its connections.
+		*/
+		trackable(const trackable&) noexcept {}
+		trackable& operator=(const trackable&) noexcept { return *this; }
+
+		~trackable()
+		{
+			disconnect_tracked_slots();
+		}
+
+		/**
+		* @brief Disconnects all the slots connected to this receiver.
+		*
+		* Called by the destructor, but it can be called earlier (e.g. first thing in the derived class' destructor)
+		* so that no slot can be invoked while the derived part of the receiver is being destroyed.
+		* Returns once the slots of this receiver being invoked by other threads have finished.
+		*/
+		void disconnect_tracked_slots()
+		{
+			std::vector<std::weak_ptr<priv::slot_base>> tracked_slots;
+			{
+				std::lock_guard lock(m_mtx);
+				tracked_slots.swap(m_tracked_slots);
+			}
+			// Never tracked anything (or already done)
+			if (tracked_slots.capacity() == 0)
+				return;
+			for (const auto& wp_slot : tracked_slots)
+			{
+				if (auto sp_slot = wp_slot.lock())
+				{
+					sp_slot->invalidate_receiver();
+					if (auto sp_list = sp_slot->get_list())
+						sp_list->remove(*sp_slot);
+				}
+			}
+			priv::wait_for_hazards(this);
+		}
+
+	private:
+		template<typename, typename...>
+		friend class basic_signal;
+
+		void track(std::weak_ptr<priv::slot_base> wp_slot) const
+		{
+			std::lock_guard lock(m_mtx);
+			// Destroyed slots (disconnected by other means and without pending queued calls) are purged before growing,
+			// so the storage stays bounded by the live connections.
+			if (m_tracked_slots.size() == m_tracked_slots.capacity())
+			{
+				std::erase_if(m_tracked_slots, [](const std::weak_ptr<priv::slot_base>& wp_tracked)
+				{
+					return wp_tracked.expired();
+				});
+			}
+			m_tracked_slots.emplace_back(std::move(wp_slot));
+		}
+
+		mutable std::mutex m_mtx;
+		mutable std::vector<std::weak_ptr<priv::slot_base>> m_tracked_slots;
+	};
+
+	/**
+	* @class spin_mutex
+	* @brief A one byte spin lock, for the slots lists of signals that are rarely connected or disconnected concurrently.
+	*
+	* Satisfies the Lockable requirements, so it can be used as the mutex of a signal_policy.
+	*/
+	class spin_mutex
+	{
+	public:
+		void lock() noexcept
+		{
+			while (m_locked.exchange(true, std::memory_order_acquire))
+			{
+				while (m_locked.load(std::memory_order_relaxed))
+					std::this_thread::yield();
+			}
+		}
+
+		bool try_lock() noexcept
+		{
+			return !m_locked.load(std::memory_order_relaxed) && !m_locked.exchange(true, std::memory_order_acquire);
+		}
+
+		void unlock() noexcept
+		{
+			m_locked.store(false, std::memory_order_release);
+		}
+
+	private:
+		std::atomic_bool m_locked{ false };
+	};
+
+	/**
+	* @class intrusive_payload
+	* @brief Base of the payload types embedding their own reference count (see shared_payload).
+	*
+	* When the last shared_payload handle is released, recycle() is called: it deletes the payload by default,
+	* override it to return the payload to a pool instead.
+	*/
+	class intrusive_payload
+	{
+	public:
+		intrusive_payload() = default;
+
+		/**
+		* @brief A copy is a new payload: the reference count is not copied.
+		*/
+		intrusive_payload(const intrusive_payload&) noexcept {}
+		intrusive_payload& operator=(const intrusive_payload&) noexcept { return *this; }
+
+	protected:
+		virtual ~intrusive_payload() = default;
+
+		/**
+		* @brief Called by the thread releasing the last handle on the payload.
+		*/
+		virtual void recycle() const noexcept { delete this; }
+
+	private:
+		template<typename T>
+		friend class shared_payload;
+		mutable std::atomic<std::uint32_t> m_payload_refs{ 0 };
+	};
+
+	namespace priv
+	{
+		// Block of a non-intrusive shared_payload: the reference count and the value in a single allocation.
+		template<typename T>
+		struct payload_block final : public intrusive_payload
+		{
+			template<typename... UARGS>
+			explicit payload_block(std::in_place_t, UARGS&&... args)
+				: value(std::forward<UARGS>(args)...)
+			{
+			}
+
+			const T value;
+		};
+	}
+
+	/**
+	* @class shared_payload
+	* @brief Reference-counted handle on an immutable payload, for the large arguments received by many slots (frames, documents, ...).
+	*
+	* A signal whose argument is a shared_payload shares the payload with all its direct and queued slots:
+	* the queued calls hold a handle on it instead of a copy of the arguments (no allocation per emission).
+	* The slots can take the handle (to keep the payload alive) or directly a const reference to the payload.
+	*
+	* @code
+	* sisl::signal<sisl::shared_payload<frame>> on_frame;
+	* sisl::connect(on_frame, [](const frame& f) { display(f); }, ui_thread_id);
+	* emit on_frame(sisl::make_shared_payload<frame>(width, height));
+	* @endcode
+	*
+	* @tparam T Type of the payload, types deriving from intrusive_payload embed the reference count (and can be pooled).
+	*/
+	template<typename T>
+	class shared_payload
+	{
+	public:
+		static constexpr bool is_intrusive = std::is_base_of_v<intrusive_payload, T>;
+
+		shared_payload() noexcept = default;
+
+		/**
+		* @brief Shares an intrusive payload (e.g. taken from a pool), recycled when its last handle is released.
+		*/
+		explicit shared_payload(const T* p_payload) noexcept requires is_intrusive
+			: m_p_block(p_payload)
+		{
+			acquire();
+		}
+
+		shared_payload(const shared_payload& other) noexcept
+			: m_p_block(other.m_p_block)
+		{
+			acquire();
+		}
+
+		shared_payload(shared_payload&& other) noexcept
+			: m_p_block(std::exchange(other.m_p_block, nullptr))
+		{
+		}
+
+		shared_payload& operator=(shared_payload other) noexcept
+		{
+			std::swap(m_p_block, other.m_p_block);
+			return *this;
+		}
+
+		~shared_payload()
+		{
+			release();
+		}
+
+		const T& get() const noexcept
+		{
+			if constexpr (is_intrusive)
+				return *m_p_block;
+			else
+				return m_p_block->value;
+		}
+
+		const T& operator*() const noexcept { return get(); }
+		const T* operator->() const noexcept { return &get(); }
+		explicit operator bool() const noexcept { return m_p_block != nullptr; }
+
+		/**
+		* @brief Lets the slots take a const reference to the payload.
+		*/
+		operator const T&() const noexcept { return get(); }
+
+		/**
+		* @brief Number of handles sharing the payload (0 for an empty handle).
+		*/
+		std::uint32_t use_count() const noexcept
+		{
+			return m_p_block ? base().m_payload_refs.load(std::memory_order_relaxed) : 0;
+		}
+
+	private:
+		using block_type = std::conditional_t<is_intrusive, T, priv::payload_block<T>>;
+
+		template<typename U, typename... UARGS>
+		friend shared_payload<U> make_shared_payload(UARGS&&... args);
+
+		const intrusive_payload& base() const noexcept
+		{
+			return *m_p_block;
+		}
+
+		void acquire() noexcept
+		{
+			if (m_p_block)
+				base().m_payload_refs.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void release() noexcept
+		{
+			if (m_p_block && base().m_payload_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				base().recycle();
+		}
+
+		const block_type* m_p_block = nullptr;
+	};
+
+	/**
+	* @brief Creates a payload shared by all the slots of the emissions (a single allocation for the reference count and the payload).
+	*
+	* @param args Arguments of the constructor of the payload.
+	*/
+	template<typename T, typename... UARGS>
+	shared_payload<T> make_shared_payload(UARGS&&... args)
+	{
+		if constexpr (shared_payload<T>::is_intrusive)
+		{
+			return shared_payload<T>(new T(std::forward<UARGS>(args)...));
+		}
+		else
+		{
+			shared_payload<T> payload;
+			payload.m_p_block = new priv::payload_block<T>(std::in_place, std::forward<UARGS>(args)...);
+			payload.acquire();
+			return payload;
+		}
+	}
+
+	namespace priv
+	{
+		template<typename T>
+		struct is_shared_payload : std::false_type {};
+
+		template<typename T>
+		struct is_shared_payload<shared_payload<T>> : std::true_type {};
+
+		// Arguments shared by the queued calls of an emission: a tuple of the arguments,
+		// or directly the handle of the signals having a single shared_payload argument (no allocation).
+		template<typename... TARGS>
+		struct queued_payload
+		{
+			using type = std::shared_ptr<std::tuple<std::remove_reference_t<TARGS>...>>;
+			static constexpr bool is_handle = false;
+		};
+
+		template<typename TARG>
+		requires (is_shared_payload<std::remove_cvref_t<TARG>>::value)
+		struct queued_payload<TARG>
+		{
+			using type = std::remove_cvref_t<TARG>;
+			static constexpr bool is_handle = true;
+		};
+	}
+
+	/**
+	* @struct signal_policy
+	* @brief Compile-time settings of a signal.
+	*
+	* @tparam DELEGATE_STORAGE_SIZE Size (in bytes) of the inline storage of each slot connected to the signal.
+	*		Smaller values shrink per-connection memory, callables that don't fit are stored in a pooled heap block.
+	* @tparam TMUTEX Mutex protecting the slots list of the signal (only allocated by its first connection).
+	*		Emissions take it in shared mode if it supports it (std::shared_mutex), exclusively otherwise (std::mutex, spin_mutex).
+	* @tparam TRESULT Result type of the slots (see basic_signal::collect()), void if their results are discarded.
+	* @tparam TALLOCATOR Allocator of the slots and of the arguments of the queued emissions (see SISL_ALLOCATOR).
+	*/
+	template<std::size_t DELEGATE_STORAGE_SIZE = SISL_DELEGATE_STORAGE_SIZE, typename TMUTEX = SISL_SLOTS_MUTEX, typename TRESULT = void, typename TALLOCATOR = SISL_ALLOCATOR>
+	struct signal_policy
+	{
+		static constexpr std::size_t delegate_storage_size = DELEGATE_STORAGE_SIZE;
+		using mutex_type = TMUTEX;
+		using result_type = TRESULT;
+		using allocator_type = TALLOCATOR;
+	};
+
+	// forward declaration of signal class
+	template<typename TPOLICY, typename...TARGS>
+	class basic_signal;
+
+	namespace priv
+	{
+		// Result type of the slots of a policy (void if the policy doesn't define it).
+		template<typename TPOLICY, typename = void>
+		struct policy_result { using type = void; };
+
+		template<typename TPOLICY>
+		struct policy_result<TPOLICY, std::void_t<typename TPOLICY::result_type>> { using type = typename TPOLICY::result_type; };
+
+		// Allocator of a policy (SISL_ALLOCATOR if the policy doesn't define it).
+		template<typename TPOLICY, typename = void>
+		struct policy_allocator { using type = SISL_ALLOCATOR; };
+
+		template<typename TPOLICY>
+		struct policy_allocator<TPOLICY, std::void_t<typename TPOLICY::allocator_type>> { using type = typename TPOLICY::allocator_type; };
+
+		// result_signal<TRESULT(TARGS...)>
+		template<typename TSIGNATURE>
+		struct result_signal_of;
+
+		template<typename TRESULT, typename... TARGS>
+		struct result_signal_of<TRESULT(TARGS...)> { using type = basic_signal<signal_policy<SISL_DELEGATE_STORAGE_SIZE, SISL_SLOTS_MUTEX, TRESULT>, TARGS...>; };
+	}
+
+	/**
+	* @brief Signal with the default policy (see signal_policy).
+	*
+	* @code
+	* sisl::signal<int, float> on_value;	// Slots taking (int, float)
+	* @endcode
+	*/
+	template<typename...TARGS>
+	using signal = basic_signal<signal_policy<>, TARGS...>;
+
+	/**
+	* @brief Signal with the default policy whose slots return a result, the results can be combined (see basic_signal::collect()).
+	*
+	* @code
+	* sisl::result_signal<int(int)> on_request;	// Slots taking an int and returning an int
+	* @endcode
+	*/
+	template<typename TSIGNATURE>
+	using result_signal = typename priv::result_signal_of<TSIGNATURE>::type;
+
+	/**
+	* @brief Signal whose slots use an inline storage of STORAGE_SIZE bytes.
+	* 
+	* @code
+	* sisl::sized_signal<16, int> on_value; // Slots bigger than 16 bytes are stored in a pooled heap block
+	* @endcode
+	*/
+	template<std::size_t STORAGE_SIZE, typename...TARGS>
+	using sized_signal = basic_signal<signal_policy<STORAGE_SIZE>, TARGS...>;
+
+	/**
+	* @brief Combiners of the results of the slots (see basic_signal::collect()).
+	*
+	* A combiner is called with each result (operator()) and returns the combined value with result().
+	* Any type with these two members can be used as a combiner.
+	*/
+	namespace combiner
+	{
+		/**
+		* @brief Keeps the result of the last called slot (nullopt if no slot was called).
+		*/
+		template<typename T>
+		struct last
+		{
+			void operator()(T value) { m_value = std::move(value); }
+			std::optional<T> result() { return std::move(m_value); }
+
+			std::optional<T> m_value;
+		};
+
+		/**
+		* @brief Sums the results of the slots (T() if no slot was called).
+		*/
+		template<typename T>
+		struct sum
+		{
+			void operator()(T value) { m_value = m_value + value; }
+			T result() { return m_value; }
+
+			T m_value = T();
+		};
+
+		/**
+		* @brief Keeps the smallest result of the slots (nullopt if no slot was called).
+		*/
+		template<typename T>
+		struct minimum
+		{
+			void operator()(T value) { if (!m_value || value < *m_value) m_value = std::move(value); }
+			std::optional<T> result() { return std::move(m_value); }
+
+			std::optional<T> m_value;
+		};
+
+		/**
+		* @brief Keeps the greatest result of the slots (nullopt if no slot was called).
+		*/
+		template<typename T>
+		struct maximum
+		{
+			void operator()(T value) { if (!m_value || *m_value < value) m_value = std::move(value); }
+			std::optional<T> result() { return std::move(m_value); }
+
+			std::optional<T> m_value;
+		};
+
+		/**
+		* @brief True if all the slots returned true (or if no slot was called).
+		*/
+		struct all_of
+		{
+			void operator()(bool value) { m_value = m_value && value; }
+			bool result() const { return m_value; }
+
+			bool m_value = true;
+		};
+
+		/**
+		* @brief Folds the results of the slots with a custom reducer: value = reducer(value, result).
+		*
+		* @code
+		* auto product = on_request.collect(sisl::combiner::reduce(1, std::multiplies<int>()), 42);
+		* @endcode
+		*/
+		template<typename T, typename TREDUCER>
+		struct reduce
+		{
+			reduce(T init, TREDUCER reducer) : m_value(std::move(init)), m_reducer(std::move(reducer)) {}
+
+			template<typename U>
+			void operator()(U&& value) { m_value = m_reducer(std::move(m_value), std::forward<U>(value)); }
+			T result() { return std::move(m_value); }
+
+			T m_value;
+			TREDUCER m_reducer;
+		};
+	}
+
+	/**
+	* @brief Connects a member function to a member signal.
+	*
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple: &COwner::my_signal).
+	* @param instance Reference to the receiver object.
+	* @param method Pointer to the member function.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
+	connection connect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, TINSTANCE& instance, TMETHOD method, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return (owner.*signal).connect(&owner, instance, method, target, type);
+	}
+
+	/**
+	* @brief Connects a member function to a standalone signal.
+	*
+	* @param signal Reference to the signal.
+	* @param instance Reference to the receiver object.
+	* @param method Pointer to the member function.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TINSTANCE, typename TMETHOD>
+	connection connect(basic_signal<TPOLICY, TARGS...>& signal, TINSTANCE& instance, TMETHOD method, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return signal.connect(nullptr, instance, method, target, type);
+	}
+
+	/**
+	* @brief Connects a generic callable object (e.g. lambda, functor) to a member signal.
+	*
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple: &COwner::my_signal).
+	* @param functor Reference to the callable object.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TFUNCTOR>
+	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
+	connection connect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, TFUNCTOR&& functor, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return (owner.*signal).connect(&owner, std::forward<TFUNCTOR>(functor), target, type);
+	}
+
+	/**
+	* @brief Connects a generic callable object (e.g. lambda, functor) to a standalone signal.
+	*
+	* @param signal Reference to the signal.
+	* @param functor Reference to the callable object.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TFUNCTOR>
+	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
+	connection connect(basic_signal<TPOLICY, TARGS...>& signal, TFUNCTOR&& functor, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return signal.connect(nullptr, std::forward<TFUNCTOR>(functor), target, type);
+	}
+
+	/**
+	* @brief Connects a C/static function to a member signal.
+	*
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple: &COwner::my_signal).
+	* @param function Pointer to the function.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TFUNCTION>
+	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
+	connection connect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, TFUNCTION&& function, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return (owner.*signal).connect(&owner, std::forward<TFUNCTION>(function), target, type);
+	}
+
+	/**
+	* @brief Connects a C/static function to a standalone signal.
+	*
+	* @param signal Reference to the signal.
+	* @param function Pointer to the function.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TFUNCTION>
+	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
+	connection connect(basic_signal<TPOLICY, TARGS...>& signal, TFUNCTION&& function, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return signal.connect(nullptr, std::forward<TFUNCTION>(function), target, type);
+	}
+
+	/**
+	* @brief Connects a callable object receiving all the payloads of an emit_batch() in one call to a member signal.
+	*
+	* The callable takes a std::span of the payloads (see basic_signal::batch_value_type), a single emission is passed as a span of one payload.
+	*
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple: &COwner::my_signal).
+	* @param functor Reference to the callable object.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TFUNCTOR>
+	requires (priv::COMPATIBLE_BATCH_FUNCTOR<TFUNCTOR, TARGS...>)
+	connection connect_batch(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, TFUNCTOR&& functor, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return (owner.*signal).connect_batch(&owner, std::forward<TFUNCTOR>(functor), target, type);
+	}
+
+	/**
+	* @brief Connects a callable object receiving all the payloads of an emit_batch() in one call to a standalone signal.
+	*
+	* @code
+	* sisl::signal<const tick&> on_tick;
+	* sisl::connect_batch(on_tick, [](std::span<const tick> ticks) { book.apply(ticks); });
+	* @endcode
+	*
+	* @param signal Reference to the signal.
+	* @param functor Reference to the callable object.
+	* @param target Optional thread ID or event_loop in which the slot should be executed (default will be the thread of emission).
+	* @param type Connection type (default is automatic).
+	* @return Handle on the connection, it can be used to disconnect this slot in O(1) (empty if the slot was not connected).
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TFUNCTOR>
+	requires (priv::COMPATIBLE_BATCH_FUNCTOR<TFUNCTOR, TARGS...>)
+	connection connect_batch(basic_signal<TPOLICY, TARGS...>& signal, TFUNCTOR&& functor, affinity target = affinity(), type_connection type = type_connection::automatic)
+	{
+		return signal.connect_batch(nullptr, std::forward<TFUNCTOR>(functor), target, type);
+	}
+
+	/**
+	* @brief Disconnects all slots connected to this member signal.
+	* 
+	* @param owner Reference to the object owning the signal
+	* @param signal Member address of the signal (exemple : &COwner::my_signal)
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER>
+	void disconnect_all(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal)
+	{
+		(owner.*signal).disconnect_all();
+	}
+
+	/**
+	* @brief Disconnects all slots connected to the signal.
+	* 
+	* @param signal Reference to the signal.
+	*/
+	template<typename TPOLICY, typename... TARGS>
+	void disconnect_all(basic_signal<TPOLICY, TARGS...>& signal)
+	{
+		signal.disconnect_all();
+	}
+
+	/**
+	* @brief Disconnects a specific slot connected to this member signal.
+	* 
+	* @param owner Reference to the object owning the signal
+	* @param signal Member address of the signal (exemple : &COwner::my_signal)
+	* @param instance Reference to the receiver object.
+	* @param method Pointer to the member function.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
+	void disconnect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, const TINSTANCE& instance, TMETHOD method)
+	{
+		(owner.*signal).disconnect(instance, method);
+	}
+
+	/**
+	* @brief Disconnects a specific slot connected to this signal.
+	* 
+	* @param signal Reference to the signal.
+	* @param instance Reference to the receiver object.
+	* @param method Pointer to the member function.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TINSTANCE, typename TMETHOD>
+	void disconnect(basic_signal<TPOLICY, TARGS...>& signal, const TINSTANCE& instance, TMETHOD method)
+	{
+		signal.disconnect(instance, method);
+	}
+
+	/**
+	* @brief Disconnects all slots owned by an object from this member signal.
+	*
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple : &COwner::my_signal)
+	* @param object Reference to the object whose slots should be disconnected.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TOBJECT>
+	requires (!std::is_member_function_pointer_v<TOBJECT>)
+	void disconnect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, const TOBJECT& object)
+	{
+		(owner.*signal).disconnect(object);
+	}
+
+	/**
+	* @brief Disconnects all slots owned by an object from this signal.
+	* 
+	* @param signal Reference to the signal.
+	* @param object Reference to the object whose slots should be disconnected.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOBJECT>
+	requires (!std::is_member_function_pointer_v<TOBJECT>)
+	void disconnect(basic_signal<TPOLICY, TARGS...>& signal, const TOBJECT& object)
+	{
+		signal.disconnect(object);
+	}
+
+	/**
+	* @brief Disconnects all slots relying on a specific method from this member signal.
+	* 
+	* @param owner Reference to the object owning the signal.
+	* @param signal Member address of the signal (exemple : &COwner::my_signal)
+	* @param method Member function pointer to disconnect.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TOWNER, typename TMETHOD>
+	requires (std::is_member_function_pointer_v<TMETHOD>)
+	void disconnect(TOWNER& owner, basic_signal<TPOLICY, TARGS...> TOWNER::* signal, TMETHOD method)
+	{
+		(owner.*signal).disconnect(method);
+	}
+
+	/**
+	* @brief Disconnects all slots relying on a specific method from this signal.
+	*
+	* @param signal Reference to the signal.
+	* @param method Member function pointer to disconnect.
+	*/
+	template<typename TPOLICY, typename... TARGS, typename TMETHOD>
+	requires (std::is_member_function_pointer_v<TMETHOD>)
+	void disconnect(basic_signal<TPOLICY, TARGS...>& signal, TMETHOD method)
+	{
+		signal.disconnect(method);
+	}
+
+	template<typename T>
+	using lvalue_reference_if_value_t = std::conditional_t<std::is_reference_v<T>, T, const T&>;
+
+	/**
+	* @class signal
+	* @brief Represents a signal that can notify connected slots.
+	*
+	* The `signal` class encapsulates zero or more connected slots (functors, methods, or functions)
+	* and can emit events to all connected receivers.
+	*
+	* @tparam TPOLICY Compile-time settings of the signal (see signal_policy).
+	* @tparam TARGS Argument types accepted by this signal.
+	*/
+	template<typename TPOLICY, typename... TARGS>
+	class basic_signal
+	{
+	public:
+		basic_signal() = default;
+	
+		/**
+		* @brief The copy of a signal does not copy the slots.
+		*/
+		basic_signal(const basic_signal&) {}
+
+		/**
+		* @brief Move constructor for the signal.
+		*/
+		basic_signal(basic_signal&&) noexcept {}
+
+		/**
+		* @brief No affectation constructor.
+		*/
+		basic_signal& operator=(const basic_signal&) = delete;
+
+		~basic_signal()
+		{
+			if (slot_list_type* p_slots = m_slots.load(std::memory_order_acquire))
+				p_slots->release();
+		}
+
+		/**
+		 * @brief Invokes all connected slots with the provided arguments.
+		 *
+		 * This method calls each connected slot with the given arguments, removing any single-shot slots
+		 * after they are invoked.
+		 *
+		 * @param args Arguments to pass to the connected slots.
+		 */
+		template<typename... UARGS>
+		void operator()(UARGS&&... args);
+
+		/**
+		 * @brief Emits the signal and combines the results of the slots in a single pass (only for the signals with a result type).
+		 *
+		 * The combiner is called with the result of each direct and blocking_queued slot, in the emitter's thread
+		 * (or in the receiver's thread while the emitter waits). Queued and pooled slots are still posted, but their results are discarded:
+		 * see collect_async() to wait for them.
+		 *
+		 * @code
+		 * sisl::result_signal<int(int)> on_request;
+		 * int total = on_request.collect(sisl::combiner::sum<int>(), 42);
+		 * @endcode
+		 *
+		 * @param combiner Object called with each result (operator()), whose result() is returned (see sisl::combiner).
+		 * @param args Arguments to pass to the connected slots.
+		 */
+		template<typename TCOMBINER, typename... UARGS>
+		requires (!std::is_void_v<typename priv::policy_result<TPOLICY>::type>)
+		priv::combiner_result_t<TCOMBINER> collect(TCOMBINER combiner, UARGS&&... args);
+
+		/**
+		 * @brief Emits the signal and returns a future of the combined results of all the slots, queued ones included.
+		 *
+		 * The future is ready once every queued call of the emission has been invoked or dropped (terminated loop, exited thread).
+		 * The results are combined in the threads invoking the slots, under a lock of the emission, in the order of the invocations.
+		 *
+		 * @param combiner Object called with each result (operator()), whose result() is returned (see sisl::combiner).
+		 * @param args Arguments to pass to the connected slots.
+		 */
+		template<typename TCOMBINER, typename... UARGS>
+		requires (!std::is_void_v<typename priv::policy_result<TPOLICY>::type>)
+		std::future<priv::combiner_result_t<TCOMBINER>> collect_async(TCOMBINER combiner, UARGS&&... args);
+
+		/**
+		 * @brief Payload of emit_batch(): the argument for the signals with a single argument, a std::tuple of the arguments otherwise.
+		 */
+		using batch_value_type = priv::batch_value_t<TARGS...>;
+
+		/**
+		 * @brief Emits the signal once per payload, in a single operation.
+		 *
+		 * The slots list is read once, and the queued slots of a same thread (or event loop, or the pool) share a single queued call
+		 * carrying the whole batch: one enqueue and one wakeup per target. The batch is copied once for all the queued slots.
+		 * Each slot receives the payloads in order, before the next slot (the ones connected with connect_batch() receive them in one call).
+		 * A single_shot slot receives the whole batch. The emitter waits for the blocking_queued slots after posting all the targets.
+		 * The results of the slots are discarded.
+		 *
+		 * @code
+		 * std::vector<tick> ticks = feed.read();
+		 * on_tick.emit_batch(ticks);
+		 * @endcode
+		 *
+		 * @param batch Payloads to emit.
+		 */
+		void emit_batch(std::span<const batch_value_type> batch);
+
+		/**
+		 * @brief Emits the signal once, after a delay, from the poll() of the current thread (or of the event loop it is polling).
+		 *
+		 * The arguments are stored until the emission, which is a regular emission made by the first poll() after the deadline:
+		 * poll() waits until the nearest deadline of its timers at most, so no timer thread is needed.
+		 * The emission is dropped if the signal is destroyed before, or if the thread never polls again.
+		 *
+		 * @code
+		 * sisl::timer retry = on_retry.emit_after(std::chrono::milliseconds(100), request_id);
+		 * @endcode
+		 *
+		 * @param delay Delay before the emission.
+		 * @param args Arguments of the emission.
+		 * @return A handle to cancel the emission.
+		 */
+		template<typename... UARGS>
+		timer emit_after(std::chrono::steady_clock::duration delay, UARGS&&... args);
+
+		/**
+		 * @brief Emits the signal periodically from the poll() of the current thread (or of the event loop it is polling), like emit_after().
+		 *
+		 * Each emission receives a copy of the stored arguments. A late poll() emits once and skips the missed periods.
+		 * The emissions stop when the timer is cancelled or the signal is destroyed.
+		 *
+		 * @param period Delay before the first emission, then between two emissions.
+		 * @param args Arguments of the emissions.
+		 * @return A handle to cancel the emissions.
+		 * @throws invalid_timer_period if the period is not strictly positive.
+		 */
+		template<typename... UARGS>
+		timer emit_every(std::chrono::steady_clock::duration period, UARGS&&... args);
+
+#ifdef SISL_INSTRUMENTATION
+		/**
+		 * @brief Returns the number of emissions of the signal since its first connection (see SISL_INSTRUMENTATION).
+		 */
+		std::uint64_t emit_count() const noexcept
+		{
+			const slot_list_type* p_slots = m_slots.load(std::memory_order_acquire);
+			return p_slots ? p_slots->get_nb_emits() : 0;
+		}
+#endif // SISL_INSTRUMENTATION
+
+	private:
+		using result_type = typename priv::policy_result<TPOLICY>::type;
+		using slot_return = priv::slot_return_t<result_type>;
+		using slot_type = priv::slot<TPOLICY::delegate_storage_size, slot_return, lvalue_reference_if_value_t<TARGS>...>;
+		using slot_list_type = priv::slot_list<typename TPOLICY::mutex_type>;
+
+		using batch_slot_type = priv::batch_slot<TPOLICY::delegate_storage_size, batch_value_type, lvalue_reference_if_value_t<TARGS>...>;
+
+		using payload_type = std::tuple<std::remove_reference_t<TARGS>...>;
+		using queued_payload = typename priv::queued_payload<TARGS...>::type;
+		using allocator_type = typename priv::policy_allocator<TPOLICY>::type;
+
+		template<typename T>
+		using std_allocator = priv::std_allocator<T, allocator_type>;
+
+		template<typename TSLOT, typename TCALLEE>
+		static std::shared_ptr<TSLOT> make_slot(TCALLEE&& callee, const priv::delegate_info& info)
+		{
+			return std::allocate_shared<TSLOT>(std_allocator<TSLOT>(), std::forward<TCALLEE>(callee), info);
+		}
+
+		// Promise of a blocking_queued call, its shared state is allocated by the allocator of the signal too.
+		static std::shared_ptr<std::promise<void>> make_done_promise()
+		{
+			return std::allocate_shared<std::promise<void>>(std_allocator<std::promise<void>>(), std::allocator_arg, std_allocator<std::promise<void>>());
+		}
+
+		// Move-only arguments are moved to their slot: a single slot can receive them (see invalid_move_only_emission).
+		static constexpr bool has_move_only_args = ((!std::is_reference_v<TARGS> && !std::is_copy_constructible_v<TARGS>) || ...);
+
+		template<typename TSINK, typename... UARGS>
+		void emit_impl(TSINK& sink, UARGS&&... args);
+
+		// Emits to a slots list, p_signal only identifies the signal (trace and slow slot reports): the timers emit without their signal.
+		template<typename TSINK, typename... UARGS>
+		static void emit_to(slot_list_type& slots, const void* p_signal, TSINK& sink, UARGS&&... args);
+
+		// Schedules a timer emitting the given arguments (a single emission if period is zero).
+		template<typename... UARGS>
+		timer schedule(std::chrono::steady_clock::duration delay, std::chrono::steady_clock::duration period, UARGS&&... args);
+
+		// Calls the callable of a slot, the value arguments are moved if the slot consumes its payload (see priv::slot::consume()).
+		template<typename TCALLABLE>
+		static decltype(auto) invoke_payload(TCALLABLE&& callable, bool consume, lvalue_reference_if_value_t<TARGS>... args)
+		{
+			constexpr bool accepts_const_args = std::is_invocable_v<TCALLABLE&, lvalue_reference_if_value_t<TARGS>...>;
+			static_assert(accepts_const_args || has_move_only_args, "[SISL] connect(): A slot can only take rvalue references of the move-only arguments of its signal.");
+			if constexpr (accepts_const_args)
+			{
+				if (!consume)
+					return callable(args...);
+			}
+			return callable(priv::consume_arg<TARGS>(args)...);
+		}
+
+		// Invokes a queued slot with the payload of its call.
+		static slot_return invoke_queued(slot_type& slot, queued_payload& payload, bool consume)
+		{
+			if constexpr (priv::queued_payload<TARGS...>::is_handle)
+				return consume ? slot.consume(payload) : slot(payload);
+			else
+				return std::apply([&slot, consume](auto&... args) { return consume ? slot.consume(args...) : slot(args...); }, *payload);
+		}
+
+		// Calls a slot with each payload of a batch (or once with the whole batch), returns false if its receiver is dead.
+		static bool invoke_batch(slot_type& slot, std::span<const batch_value_type> batch);
+
+		template<typename TFUNCTOR>
+		connection connect_batch(void* owner, TFUNCTOR&& functor, const affinity& target, type_connection type);
+
+		template<typename TINSTANCE, typename TMETHOD>
+		requires priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>
+		connection connect(void* owner, TINSTANCE& instance, TMETHOD method, const affinity& target, type_connection type)
+		{
+			return connect_to_instance_impl(owner, instance, method, target, type);
+		}
+
+		template<typename TINSTANCE, typename TMETHOD>
+		requires priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>
+		connection connect(void* owner, std::shared_ptr<TINSTANCE>& instance, TMETHOD method, const affinity& target, type_connection type)
+		{
+			return connect_to_instance_impl(owner, instance, method, target, type);
+		}
+
+		template<typename TINSTANCE, typename TMETHOD>
+		connection connect_to_instance_impl(void* owner, TINSTANCE& instance, TMETHOD method, const affinity& target, type_connection type);
+
+		template<typename TFUNCTOR>
+		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
+		connection connect(void* owner, TFUNCTOR&& functor, const affinity& target, type_connection type);
+
+		template<typename TFUNCTION>
+		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
+		connection connect(void* owner, TFUNCTION&& function, const affinity& target, type_connection type);
+
+		template<typename TINSTANCE, typename TMETHOD>
+		requires (!priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>)
+		connection connect(void*, TINSTANCE&, TMETHOD, const affinity&, type_connection)
+		{ 
+			static_assert(sizeof(TINSTANCE) == 0, "[SISL] connect(): The provided method is not a member of the given object type or its argument types are incompatible with the signal's expected argument types.");
+			return {};
+		}
+
+		template<typename TFUNCTOR>
+		requires (priv::is_functor_v<TFUNCTOR> && !priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
+		connection connect(void*, TFUNCTOR&&, type_connection type = type_connection::automatic)
+		{
+			static_assert(sizeof(TFUNCTOR) == 0, "[SISL] connect(): The provided functor's argument types are incompatible with the signal's expected argument types.");
+			return {};
+		}
+
+		template<typename TFUNCTION>
+		requires (std::is_function_v<std::remove_pointer_t<TFUNCTION>> && !priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
+		connection connect(void*, TFUNCTION&&, type_connection type = type_connection::automatic)
+		{
+			static_assert(sizeof(TFUNCTION) == 0, "[SISL] connect(): The provided function's argument types are incompatible with the signal's expected argument types.");
+			return {};
+		}
+
+		void disconnect_all();
+
+		template<typename TINSTANCE, typename TMETHOD>
+		void disconnect(TINSTANCE& instance, TMETHOD method);
+
+		template<typename TOBJECT>
+		requires (!std::is_member_function_pointer_v<TOBJECT>)
+		void disconnect(const TOBJECT& instance);
+
+		template<typename TMETHOD>
+		requires (std::is_member_function_pointer_v<TMETHOD>)
+		void disconnect(TMETHOD method);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
+		friend connection connect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, TINSTANCE&, TMETHOD, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TINSTANCE, typename TMETHOD>
+		friend connection connect(basic_signal<UPOLICY, UARGS...>&, TINSTANCE&, TMETHOD, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TFUNCTOR>
+		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, UARGS...>)
+		friend connection connect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, TFUNCTOR&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TFUNCTOR>
+		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, UARGS...>)
+		friend connection connect(basic_signal<UPOLICY, UARGS...>&, TFUNCTOR&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TFUNCTION>
+		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, UARGS...>)
+		friend connection connect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, TFUNCTION&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TFUNCTION>
+		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, UARGS...>)
+		friend connection connect(basic_signal<UPOLICY, UARGS...>&, TFUNCTION&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TFUNCTOR>
+		requires (priv::COMPATIBLE_BATCH_FUNCTOR<TFUNCTOR, UARGS...>)
+		friend connection connect_batch(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, TFUNCTOR&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TFUNCTOR>
+		requires (priv::COMPATIBLE_BATCH_FUNCTOR<TFUNCTOR, UARGS...>)
+		friend connection connect_batch(basic_signal<UPOLICY, UARGS...>&, TFUNCTOR&&, affinity, type_connection);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
+		friend void disconnect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, const TINSTANCE&, TMETHOD);
+
+		template<typename UPOLICY, typename... UARGS, typename TINSTANCE, typename TMETHOD>
+		friend void disconnect(basic_signal<UPOLICY, UARGS...>&, const TINSTANCE&, TMETHOD);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TOBJECT>
+		requires (!std::is_member_function_pointer_v<TOBJECT>)
+		friend void disconnect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, const TOBJECT&);
+
+		template<typename UPOLICY, typename... UARGS, typename TOBJECT>
+		requires (!std::is_member_function_pointer_v<TOBJECT>)
+		friend void disconnect(basic_signal<UPOLICY, UARGS...>&, const TOBJECT&);
+
+		template<typename UPOLICY, typename... UARGS, typename TOWNER, typename TMETHOD>
+		requires (std::is_member_function_pointer_v<TMETHOD>)
+		friend void disconnect(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*, TMETHOD);
+
+		template<typename UPOLICY, typename... UARGS, typename TMETHOD>
+		requires (std::is_member_function_pointer_v<TMETHOD>)
+		friend void disconnect(basic_signal<UPOLICY, UARGS...>&, TMETHOD);
+
+		template <typename UPOLICY, typename... UARGS, typename TOWNER>
+		friend void disconnect_all(TOWNER&, basic_signal<UPOLICY, UARGS...> TOWNER::*);
+
+		template<typename UPOLICY, typename... UARGS>
+		friend void disconnect_all(basic_signal<UPOLICY, UARGS...>&);
+		
+		// The slots list is only created by the first connection: an unconnected signal is a single null pointer,
+		// and the operations that don't connect never have to create (nor lock) anything.
+		std::atomic<slot_list_type*> m_slots{ nullptr };
+
+		slot_list_type* get_slots() const noexcept
+		{
+			return m_slots.load(std::memory_order_acquire);
+		}
+
+		slot_list_type& get_or_create_slots()
+		{
+			slot_list_type* p_slots = m_slots.load(std::memory_order_acquire);
+			if (p_slots)
+				return *p_slots;
+			// Several threads may connect the first slots at the same time, only one list is installed
+			slot_list_type* p_new_slots = slot_list_type::create();
+			if (m_slots.compare_exchange_strong(p_slots, p_new_slots, std::memory_order_acq_rel, std::memory_order_acquire))
+				return *p_new_slots;
+			p_new_slots->release();
+			return *p_slots;
+		}
+	};
+}
+
+// <=====================================================================================>
+// <=============				Templates implementation					=============>
+// <=====================================================================================>
+
+namespace SISL_NAMESPACE
+{
+	namespace priv
+	{
+		extern thread_local void* gtl_current_sender;
+		// The queue (of a thread or an event loop) being polled by the current thread, nullptr outside of a poll.
+		extern thread_local async_delegates* gtl_polled_queue;
+
+		// Threshold of the slow slot detector in nanoseconds, 0 while it is disabled (see set_slow_slot_handler()).
+		extern std::atomic<std::int64_t> g_slow_slot_threshold_ns;
+
+		// Reports a slot invocation to the slow slot handler if it lasted longer than the threshold.
+		void report_if_slow_slot(std::chrono::steady_clock::time_point start, const void* signal, const delegate_info& info);
+
+		// Times a slot invocation while the slow slot detector is enabled.
+		class slot_timer
+		{
+		public:
+			slot_timer() noexcept
+				: m_enabled(g_slow_slot_threshold_ns.load(std::memory_order_relaxed) != 0)
+			{
+				if (m_enabled)
+					m_start = std::chrono::steady_clock::now();
+			}
+
+			void stop(const void* signal, const delegate_info& info)
+			{
+				if (m_enabled)
+					report_if_slow_slot(m_start, signal, info);
+			}
+
+		private:
+			bool m_enabled;
+			std::chrono::steady_clock::time_point m_start;
+		};
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TINSTANCE, typename TMETHOD>
+	connection basic_signal<TPOLICY, TARGS...>::connect_to_instance_impl(void* owner, TINSTANCE& instance, TMETHOD method, const affinity& target, type_connection type)
+	{
+		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&instance), priv::function_id::of(method), target.get_thread_id(), type, target.get_loop(), target.get_loop() != nullptr };
+		using receiver_t = typename priv::receiver_type<std::decay_t<TINSTANCE>>::type;
+
+		// Trackable receivers disconnect their slots when they are destroyed, and are protected by hazard pointers during the invocations.
+		// So their slots directly call the method, even if the receiver is managed by shared_ptr (no weak_ptr::lock() per call).
+		if constexpr (std::is_base_of_v<trackable, receiver_t>)
+		{
+			receiver_t* p_receiver = [&]()
+			{
+				if constexpr (priv::is_shared_ptr_v<std::decay_t<TINSTANCE>>)
+					return instance.get();
+				else
+					return &instance;
+			}();
+			auto callee = [p_receiver, method](bool consume, lvalue_reference_if_value_t<TARGS>... args) -> slot_return
+			{
+				return priv::call_slot<slot_return>([&]() -> decltype(auto) { return invoke_payload(std::bind_front(method, p_receiver), consume, args...); });
+			};
+			auto sp_callee = make_slot<slot_type>(std::move(callee), info);
+			const trackable& tracker = *p_receiver;
+			sp_callee->set_tracker(&tracker);
+			// With a unique connection, the slot already connected (if any) is kept and returned
+			std::shared_ptr<priv::slot_base> sp_connected = get_or_create_slots().add(sp_callee, type & type_connection::unique);
+			if (sp_connected == sp_callee)
+				tracker.track(sp_connected);
+			return connection(sp_connected);
+		}
+		// if the target instance is managed by shared_ptr, we may have more secure delegate to create
+		else if constexpr (priv::has_weak_from_this<TINSTANCE> || priv::is_shared_ptr_v<std::decay_t<TINSTANCE>>)
+		{
+			auto weak_instance = [&]() 
+			{
+				if constexpr (priv::is_shared_ptr_v<std::decay_t<TINSTANCE>>) 
+					return std::weak_ptr(instance);
+				else 
+					return instance.weak_from_this();
+			}();
+			if (!weak_instance.expired())
+			{
+				auto callee = [weak_instance, method](bool consume, lvalue_reference_if_value_t<TARGS>... args) -> slot_return
+				{
+					if (auto shared_instance = weak_instance.lock())
+					{
+						return priv::call_slot<slot_return>([&]() -> decltype(auto) { return invoke_payload(std::bind_front(method, shared_instance.get()), consume, args...); });
+					}
+					else
+					{
+						return {}; // Instance is no longer valid
+					}
+				};
+				auto sp_callee = make_slot<slot_type>(std::move(callee), info);
+				// With a unique connection, the slot already connected (if any) is kept and returned
+				return connection(get_or_create_slots().add(std::move(sp_callee), type & type_connection::unique));
+			}
+			return connection();
+		}
+		else
+		{
+			// otherwise we just call the method, no check
+			auto callee = [&instance, method](bool consume, lvalue_reference_if_value_t<TARGS>... args) -> slot_return
+			{
+				return priv::call_slot<slot_return>([&]() -> decltype(auto) { return invoke_payload(std::bind_front(method, &instance), consume, args...); });
+			};
+			auto sp_callee = make_slot<slot_type>(std::move(callee), info);
+			// With a unique connection, the slot already connected (if any) is kept and returned
+			return connection(get_or_create_slots().add(std::move(sp_callee), type & type_connection::unique));
+		}
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TFUNCTOR>
+	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
+	connection basic_signal<TPOLICY, TARGS...>::connect(void* owner, TFUNCTOR&& functor, const affinity& target, type_connection type)
+	{
+		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&functor), priv::function_id(), target.get_thread_id(), type, target.get_loop(), target.get_loop() != nullptr };
+		auto callee = [functor](bool consume, lvalue_reference_if_value_t<TARGS>... args) mutable -> slot_return
+		{
+			return priv::call_slot<slot_return>([&]() -> decltype(auto) { return invoke_payload(functor, consume, args...); });
+		};
+		auto sp_callee = make_slot<slot_type>(std::move(callee), info);
+		// With a unique connection, the slot already connected (if any) is kept and returned
+		return connection(get_or_create_slots().add(std::move(sp_callee), type & type_connection::unique));
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TFUNCTION>
+	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
+	connection basic_signal<TPOLICY, TARGS...>::connect(void* owner, TFUNCTION&& function, const affinity& target, type_connection type)
+	{
+		const priv::delegate_info info = { owner, 0, priv::function_id::of(std::decay_t<TFUNCTION>(function)), target.get_thread_id(), type, target.get_loop(), target.get_loop() != nullptr };
+		auto callee = [function](bool consume, lvalue_reference_if_value_t<TARGS>... args) -> slot_return
+		{
+			return priv::call_slot<slot_return>([&]() -> decltype(auto) { return invoke_payload(function, consume, args...); });
+		};
+		auto sp_callee = make_slot<slot_type>(std::move(callee), info);
+		// With a unique connection, the slot already connected (if any) is kept and returned
+		return connection(get_or_create_slots().add(std::move(sp_callee), type & type_connection::unique));
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TFUNCTOR>
+	connection basic_signal<TPOLICY, TARGS...>::connect_batch(void* owner, TFUNCTOR&& functor, const affinity& target, type_connection type)
+	{
+		static_assert(std::is_void_v<result_type>, "[SISL] connect_batch(): The batch slots can't be connected to a signal having a result type.");
+		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&functor), priv::function_id(), target.get_thread_id(), type, target.get_loop(), target.get_loop() != nullptr };
+		auto callee = [functor = std::forward<TFUNCTOR>(functor)](std::span<const batch_value_type> batch) mutable
+		{
+			functor(batch);
+		};
+		auto sp_callee = make_slot<batch_slot_type>(std::move(callee), info);
+		// With a unique connection, the slot already connected (if any) is kept and returned
+		return connection(get_or_create_slots().add(std::move(sp_callee), type & type_connection::unique));
+	}
+	
+	template<typename TPOLICY, typename... TARGS>
+	void basic_signal<TPOLICY, TARGS...>::disconnect_all()
+	{
+		if (slot_list_type* p_slots = get_slots())
+			p_slots->clear();
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TINSTANCE, typename TMETHOD>
+	void basic_signal<TPOLICY, TARGS...>::disconnect(TINSTANCE& instance, TMETHOD method)
+	{
+		if (slot_list_type* p_slots = get_slots())
+			p_slots->remove(priv::slot_key{ reinterpret_cast<intptr_t>(&instance), priv::function_id::of(method) });
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TOBJECT>
+	requires (!std::is_member_function_pointer_v<TOBJECT>)
+	void basic_signal<TPOLICY, TARGS...>::disconnect(const TOBJECT& instance)
+	{
+		slot_list_type* p_slots = get_slots();
+		if (!p_slots)
+			return;
+		p_slots->remove_if([&instance](const priv::slot_base& slot)
+		{
+			return slot.m_info.object == reinterpret_cast<intptr_t>(&instance);
+		});
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TMETHOD>
+	requires (std::is_member_function_pointer_v<TMETHOD>)
+	void basic_signal<TPOLICY, TARGS...>::disconnect(TMETHOD method)
+	{
+		slot_list_type* p_slots = get_slots();
+		if (!p_slots)
+			return;
+		const priv::function_id function = priv::function_id::of(method);
+		p_slots->remove_if([&function](const priv::slot_base& slot)
+		{
+			return slot.m_info.function == function;
+		});
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename... UARGS>
+	void basic_signal<TPOLICY, TARGS...>::operator()(UARGS&&... args)
+	{
+		priv::no_combiner sink;
+		emit_impl(sink, std::forward<UARGS>(args)...);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TCOMBINER, typename... UARGS>
+	requires (!std::is_void_v<typename priv::policy_result<TPOLICY>::type>)
+	priv::combiner_result_t<TCOMBINER> basic_signal<TPOLICY, TARGS...>::collect(TCOMBINER combiner, UARGS&&... args)
+	{
+		priv::sync_collector<TCOMBINER> sink{ combiner };
+		emit_impl(sink, std::forward<UARGS>(args)...);
+		return combiner.result();
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TCOMBINER, typename... UARGS>
+	requires (!std::is_void_v<typename priv::policy_result<TPOLICY>::type>)
+	std::future<priv::combiner_result_t<TCOMBINER>> basic_signal<TPOLICY, TARGS...>::collect_async(TCOMBINER combiner, UARGS&&... args)
+	{
+		priv::async_collector<TCOMBINER> sink{ std::make_shared<priv::async_collect_state<TCOMBINER>>(std::move(combiner)) };
+		std::future<priv::combiner_result_t<TCOMBINER>> future = sink.sp_state->m_promise.get_future();
+		emit_impl(sink, std::forward<UARGS>(args)...);
+		return future;
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TSINK, typename... UARGS>
+	void basic_signal<TPOLICY, TARGS...>::emit_impl(TSINK& sink, UARGS&&... args)
+	{
+		// Most signals have no listener most of the time: emitting an unconnected signal costs a single relaxed load
+		if (m_slots.load(std::memory_order_relaxed) == nullptr)
+			return;
+		emit_to(*get_slots(), this, sink, std::forward<UARGS>(args)...);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename TSINK, typename... UARGS>
+	void basic_signal<TPOLICY, TARGS...>::emit_to(slot_list_type& slots, const void* p_signal, TSINK& sink, UARGS&&... args)
+	{
+#ifdef SISL_INSTRUMENTATION
+		slots.count_emit();
+#endif // SISL_INSTRUMENTATION
+		__SISL_STATS_ADD(emits, 1);
+		const std::thread::id current_thread = std::this_thread::get_id();
+		// Copy the slot's array before looping on it (smaller contention than keeping a read-lock during the iteration)
+		std::vector<std::shared_ptr<priv::slot_base>> slots_copy;
+		std::vector<std::shared_ptr<priv::slot_base>> slots_to_remove;
+		slots.snapshot(slots_copy);
+		if (slots_copy.empty())
+			return;
+		__SISL_TRACE_SCOPE(trace_emit, emit_begin, p_signal, nullptr, type_connection::automatic);
+
+		// The only slot of an emission consumes the rvalue arguments: they are moved to the queued payload, then to the slot (no copy)
+		constexpr bool are_args_movable = ((std::is_reference_v<TARGS> || (!std::is_lvalue_reference_v<UARGS> && std::is_same_v<std::remove_reference_t<UARGS>, TARGS>)) && ...);
+		static_assert(!has_move_only_args || are_args_movable, "[SISL] emit: The move-only arguments of a signal must be passed as rvalues (std::move()).");
+		if (has_move_only_args && slots_copy.size() > 1)
+			throw invalid_move_only_emission();
+		const bool consume = are_args_movable && slots_copy.size() == 1;
+
+		// We use a shared_ptr to a tuple (or the shared_payload argument itself) to avoid copying the arguments for each queued slot
+		queued_payload args_tuple;
+
+		for (auto& sp_slot : slots_copy)
+		{
+			auto& slot = static_cast<slot_type&>(*sp_slot);
+			const priv::delegate_info& info = slot.get_info();
+			const type_connection type_without_flags = get_type_connection_without_flags(info.type);
+			const std::shared_ptr<priv::async_delegates> sp_loop = info.targets_loop ? info.loop.lock() : nullptr;
+			// Checks if the slot should be executed directly or queued (automatic connections are direct in the thread, or loop, of the receiver)
+			const bool is_receiver_context = info.targets_loop	? sp_loop && sp_loop.get() == priv::gtl_polled_queue
+																: info.thread_affinity == priv::get_empty_thread_id() || info.thread_affinity == current_thread;
+			const bool must_queue =		type_without_flags == type_connection::queued
+									||	type_without_flags == type_connection::blocking_queued
+									||	type_without_flags == type_connection::pooled
+									||	type_without_flags == type_connection::idle
+									||	(type_without_flags == type_connection::automatic && !is_receiver_context);
+			
+			bool result = true;
+			if (must_queue)
+			{
+				// We need to store the arguments in a tuple to be able to pass them to queued calls without copying them each time
+				const std::thread::id target_thread = info.thread_affinity == priv::get_empty_thread_id() ? current_thread : info.thread_affinity;
+				if(!args_tuple)
+				{
+					auto make_payload = [&](auto&&... payload_args)
+					{
+#ifdef SISL_NUMA_AWARE
+						// The arguments are read by the receiver(s): allocated on the node of the first one
+						const int numa_node = type_without_flags == type_connection::pooled ? -1 : info.targets_loop ? (sp_loop ? priv::numa_node_of(*sp_loop) : -1) : priv::numa_node_of(target_thread);
+						if (numa_node >= 0)
+							return std::allocate_shared<payload_type>(priv::numa_allocator<payload_type>(numa_node), std::forward<decltype(payload_args)>(payload_args)...);
+#endif
+						return std::allocate_shared<payload_type>(std_allocator<payload_type>(), std::forward<decltype(payload_args)>(payload_args)...);
+					};
+					if constexpr (priv::queued_payload<TARGS...>::is_handle)
+						args_tuple = queued_payload(args...);
+					else if constexpr (has_move_only_args)
+						args_tuple = make_payload(std::forward<UARGS>(args)...);
+					else
+						args_tuple = consume ? make_payload(std::forward<UARGS>(args)...) : make_payload(args...);
+				}
+
+				auto post = [p_signal, &info, &sp_loop, type_without_flags, target_thread](priv::task&& delegate) -> bool
+				{
+					priv::queued_call call(std::move(delegate));
+					__SISL_TRACE_ENQUEUE(call, p_signal, info.owner, type_without_flags);
+					const bool idle = type_without_flags == type_connection::idle;
+					bool posted = true;
+					if (type_without_flags == type_connection::pooled)
+						priv::enqueue_pooled(std::move(call));
+					else if (info.targets_loop)
+						posted = sp_loop && priv::enqueue(std::move(call), *sp_loop, idle);
+					else
+						priv::enqueue(std::move(call), target_thread, idle);
+					// Only the calls actually pushed (not the ones dropped by a terminated loop)
+					if (posted)
+					{
+						__SISL_STATS_ADD(queued_posts, 1);
+					}
+					return posted;
+				};
+				// if the slot is blocking_queued, we need to wait for the slot to finish
+				if (type_without_flags == type_connection::blocking_queued)
+				{
+					// If we are in the same thread (or loop), with blocking_queued, we MUST throw an exception because it would cause a deadlock.
+					if (info.targets_loop ? is_receiver_context : current_thread == target_thread)
+					{
+						throw invalid_blocking_queued_connection();
+					}
+					// Owned by the queued call only: if the call is dropped without being invoked (terminated loop, exited thread), the promise is broken and the wait ends.
+					auto sp_done = make_done_promise();
+					auto future_done = sp_done->get_future();
+					const bool posted = post([sp_slot, sp_done = std::move(sp_done), args_tuple, consume, p_signal, receiver = sink.queued_receiver(type_without_flags)]() mutable
+					{
+						priv::gtl_current_sender = sp_slot->get_info().owner;
+						try
+						{
+							priv::receiver_guard guard(*sp_slot);
+							if (guard.is_alive())
+							{
+								priv::slot_timer timer;
+								priv::forward_result(receiver, invoke_queued(static_cast<slot_type&>(*sp_slot), args_tuple, consume));
+								timer.stop(p_signal, sp_slot->get_info());
+							}
+							sp_done->set_value();
+						}
+						catch (...)
+						{
+							sp_done->set_exception(std::current_exception());
+						}
+						priv::gtl_current_sender = nullptr;
+					});
+					if (posted)
+					{
+						__SISL_STATS_NOW(wait_start);
+						future_done.wait();
+						__SISL_STATS_ADD(blocking_waits, 1);
+						__SISL_STATS_ADD_ELAPSED(blocking_wait_ns, wait_start);
+					}
+				}
+				// If the slot is queued, we just enqueue it
+				else
+				{
+					post([sp_slot, args_tuple, consume, p_signal, receiver = sink.queued_receiver(type_without_flags)]() mutable
+					{
+						priv::gtl_current_sender = sp_slot->get_info().owner;
+						priv::receiver_guard guard(*sp_slot);
+						if (guard.is_alive())
+						{
+							priv::slot_timer timer;
+							priv::forward_result(receiver, invoke_queued(static_cast<slot_type&>(*sp_slot), args_tuple, consume));
+							timer.stop(p_signal, sp_slot->get_info());
+						}
+						priv::gtl_current_sender = nullptr;
+					});
+				}
+			}
+			// If the slot is direct, we call it directly (unless a previous slot of this emission disconnected it)
+			else if (slot.is_connected())
+			{
+				priv::receiver_guard guard(slot);
+				if (guard.is_alive())
+				{
+					__SISL_STATS_ADD(direct_invocations, 1);
+					__SISL_TRACE_SCOPE(trace_slot, slot_begin, p_signal, info.owner, type_without_flags);
+					priv::gtl_current_sender = info.owner;
+					priv::slot_timer timer;
+					slot_return returned = consume ? slot.consume(args...) : slot(args...);
+					timer.stop(p_signal, info);
+					result = priv::is_slot_alive(returned);
+					priv::forward_result(sink, std::move(returned));
+					priv::gtl_current_sender = nullptr;
+				}
+			}
+			// If the slot is single-shot, remove it after calling
+			if (!result || ((int)info.type & (int)type_connection::single_shot))
+				slots_to_remove.push_back(sp_slot);
+		}
+
+		// Each removal is O(1)
+		for (const auto& sp_slot : slots_to_remove)
+			slots.remove(*sp_slot);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename... UARGS>
+	timer basic_signal<TPOLICY, TARGS...>::emit_after(std::chrono::steady_clock::duration delay, UARGS&&... args)
+	{
+		return schedule(delay, std::chrono::steady_clock::duration::zero(), std::forward<UARGS>(args)...);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename... UARGS>
+	timer basic_signal<TPOLICY, TARGS...>::emit_every(std::chrono::steady_clock::duration period, UARGS&&... args)
+	{
+		static_assert(!has_move_only_args, "[SISL] emit_every(): The move-only arguments can't be emitted several times.");
+		if (period <= std::chrono::steady_clock::duration::zero())
+			throw invalid_timer_period();
+		return schedule(period, period, std::forward<UARGS>(args)...);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	template<typename... UARGS>
+	timer basic_signal<TPOLICY, TARGS...>::schedule(std::chrono::steady_clock::duration delay, std::chrono::steady_clock::duration period, UARGS&&... args)
+	{
+		// The timer keeps the slots list, not the signal: a destroyed signal only leaves an expired list behind
+		std::weak_ptr<priv::slot_list_base> wp_slots = get_or_create_slots().weak_from_this();
+		const bool periodic = period > std::chrono::steady_clock::duration::zero();
+		priv::task fire([wp_slots, p_signal = static_cast<const void*>(this), payload = payload_type(std::forward<UARGS>(args)...), periodic]() mutable
+		{
+			const std::shared_ptr<priv::slot_list_base> sp_slots = wp_slots.lock();
+			if (!sp_slots)
+				return;
+			slot_list_type& slots = static_cast<slot_list_type&>(*sp_slots);
+			priv::no_combiner sink;
+			// A single emission moves its arguments to the slots, a periodic one keeps them for the next emissions
+			if (has_move_only_args || !periodic)
+				std::apply([&slots, p_signal, &sink](auto&... values) { emit_to(slots, p_signal, sink, std::move(values)...); }, payload);
+			else if constexpr (!has_move_only_args)
+				std::apply([&slots, p_signal, &sink](auto&... values) { emit_to(slots, p_signal, sink, values...); }, payload);
+		});
+		auto sp_timer = std::allocate_shared<priv::timer_state>(std_allocator<priv::timer_state>(), std::move(fire), std::move(wp_slots), period);
+		priv::schedule_timer(sp_timer, delay);
+		return timer(sp_timer);
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	bool basic_signal<TPOLICY, TARGS...>::invoke_batch(slot_type& slot, std::span<const batch_value_type> batch)
+	{
+		if (slot.accepts_batch())
+		{
+			static_cast<batch_slot_type&>(slot).call_batch(batch);
+			return true;
+		}
+		for (const batch_value_type& value : batch)
+		{
+			bool alive;
+			if constexpr (sizeof...(TARGS) == 1)
+				alive = priv::is_slot_alive(slot(value));
+			else
+				alive = priv::is_slot_alive(std::apply(slot, value));
+			if (!alive)
+				return false;
+		}
+		return true;
+	}
+
+	template<typename TPOLICY, typename... TARGS>
+	void basic_signal<TPOLICY, TARGS...>::emit_batch(std::span<const batch_value_type> batch)
+	{
+		static_assert(((!std::is_lvalue_reference_v<TARGS> || std::is_const_v<std::remove_reference_t<TARGS>>) && ...), "[SISL] emit_batch(): The payloads of a batch are const, the signal can't have non-const reference arguments.");
+		static_assert(!has_move_only_args, "[SISL] emit_batch(): The payloads of a batch are copied, the signal can't have move-only arguments.");
+		if (batch.empty() || m_slots.load(std::memory_order_relaxed) == nullptr)
+			return;
+		slot_list_type& slots = *get_slots();
+#ifdef SISL_INSTRUMENTATION
+		slots.count_emit(batch.size());
+#endif // SISL_INSTRUMENTATION
+		__SISL_STATS_ADD(emits, batch.size());
+		const std::thread::id current_thread = std::this_thread::get_id();
+		std::vector<std::shared_ptr<priv::slot_base>> slots_copy;
+		std::vector<std::shared_ptr<priv::slot_base>> slots_to_remove;
+		slots.snapshot(slots_copy);
+		if (slots_copy.empty())
+			return;
+		__SISL_TRACE_SCOPE(trace_emit, emit_begin, this, nullptr, type_connection::automatic);
+
+		// The queued slots are grouped by target (thread, event loop or pool), each group is posted as one queued call
+		struct target_group
+		{
+			const priv::delegate_info* p_info;		///< Info of the first slot of the group (target and connection type).
+			std::thread::id target_thread;
+			std::shared_ptr<priv::async_delegates> sp_loop;
+			bool blocking;
+			std::vector<std::shared_ptr<priv::slot_base>> slots;
+		};
+		std::vector<target_group> groups;
+
+		for (auto& sp_slot : slots_copy)
+		{
+			auto& slot = static_cast<slot_type&>(*sp_slot);
+			const priv::delegate_info& info = slot.get_info();
+			const type_connection type_without_flags = get_type_connection_without_flags(info.type);
+			std::shared_ptr<priv::async_delegates> sp_loop = info.targets_loop ? info.loop.lock() : nullptr;
+			const bool is_receiver_context = info.targets_loop	? sp_loop && sp_loop.get() == priv::gtl_polled_queue
+																: info.thread_affinity == priv::get_empty_thread_id() || info.thread_affinity == current_thread;
+			const bool must_queue =		type_without_flags == type_connection::queued
+									||	type_without_flags == type_connection::blocking_queued
+									||	type_without_flags == type_connection::pooled
+									||	type_without_flags == type_connection::idle
+									||	(type_without_flags == type_connection::automatic && !is_receiver_context);
+
+			bool result = true;
+			if (must_queue)
+			{
+				const std::thread::id target_thread = info.thread_affinity == priv::get_empty_thread_id() ? current_thread : info.thread_affinity;
+				const bool blocking = type_without_flags == type_connection::blocking_queued;
+				const bool pooled = type_without_flags == type_connection::pooled;
+				const bool idle = type_without_flags == type_connection::idle;
+				if (blocking && (info.targets_loop ? is_receiver_context : current_thread == target_thread))
+				{
+					throw invalid_blocking_queued_connection();
+				}
+				auto it_group = std::find_if(groups.begin(), groups.end(), [&](const target_group& group)
+				{
+					const type_connection group_type = get_type_connection_without_flags(group.p_info->type);
+					const bool group_pooled = group_type == type_connection::pooled;
+					const bool group_idle = group_type == type_connection::idle;
+					if (group.blocking != blocking || group_pooled != pooled || group_idle != idle)
+						return false;
+					return pooled || (info.targets_loop ? group.p_info->targets_loop && group.sp_loop == sp_loop : !group.p_info->targets_loop && group.target_thread == target_thread);
+				});
+				if (it_group == groups.end())
+					it_group = groups.insert(groups.end(), target_group{ &info, target_thread, std::move(sp_loop), blocking, {} });
+				it_group->slots.push_back(sp_slot);
+			}
+			else if (slot.is_connected())
+			{
+				priv::receiver_guard guard(slot);
+				if (guard.is_alive())
+				{
+					__SISL_STATS_ADD(direct_invocations, slot.accepts_batch() ? 1 : batch.size());
+					__SISL_TRACE_SCOPE(trace_slot, slot_begin, this, info.owner, type_without_flags);
+					priv::gtl_current_sender = info.owner;
+					priv::slot_timer timer;
+					result = invoke_batch(slot, batch);
+					timer.stop(this, info);
+					priv::gtl_current_sender = nullptr;
+				}
+			}
+			if (!result || ((int)info.type & (int)type_connection::single_shot))
+				slots_to_remove.push_back(sp_slot);
+		}
+
+		if (!groups.empty())
+		{
+			// A single copy of the payloads, shared by all the groups
+			using batch_payload = std::vector<batch_value_type, std_allocator<batch_value_type>>;
+			auto sp_batch = std::allocate_shared<const batch_payload>(std_allocator<batch_payload>(), batch.begin(), batch.end());
+			std::vector<std::future<void>> blocking_calls;
+			for (target_group& group : groups)
+			{
+				const priv::delegate_info& info = *group.p_info;
+				const type_connection type_without_flags = get_type_connection_without_flags(info.type);
+				std::shared_ptr<std::promise<void>> sp_done;
+				if (group.blocking)
+				{
+					sp_done = make_done_promise();
+					blocking_calls.push_back(sp_done->get_future());
+				}
+				priv::queued_call call([group_slots = std::move(group.slots), sp_batch, sp_done = std::move(sp_done), p_signal = static_cast<const void*>(this)]()
+				{
+					try
+					{
+						for (const auto& sp_slot : group_slots)
+						{
+							priv::gtl_current_sender = sp_slot->get_info().owner;
+							priv::receiver_guard guard(*sp_slot);
+							if (guard.is_alive())
+							{
+								priv::slot_timer timer;
+								invoke_batch(static_cast<slot_type&>(*sp_slot), *sp_batch);
+								timer.stop(p_signal, sp_slot->get_info());
+							}
+							priv::gtl_current_sender = nullptr;
+						}
+						if (sp_done)
+							sp_done->set_value();
+					}
+					catch (...)
+					{
+						priv::gtl_current_sender = nullptr;
+						if (!sp_done)
+							throw;
+						sp_done->set_exception(std::current_exception());
+					}
+				});
+				__SISL_TRACE_ENQUEUE(call, this, info.owner, type_without_flags);
+				bool posted = true;
+				if (type_without_flags == type_connection::pooled)
+					priv::enqueue_pooled(std::move(call));
+				else if (info.targets_loop)
+					posted = group.sp_loop && priv::enqueue(std::move(call), *group.sp_loop, type_without_flags == type_connection::idle);
+				else
+					priv::enqueue(std::move(call), group.target_thread, type_without_flags == type_connection::idle);
+				if (posted)
+				{
+					__SISL_STATS_ADD(queued_posts, 1);
+				}
+				else if (group.blocking)
+					blocking_calls.pop_back();
+			}
+			for (std::future<void>& done : blocking_calls)
+			{
+				__SISL_STATS_NOW(wait_start);
+				done.wait();
+				__SISL_STATS_ADD(blocking_waits, 1);
+				__SISL_STATS_ADD_ELAPSED(blocking_wait_ns, wait_start);
+			}
+		}
+
+		// Each removal is O(1)
+		for (const auto& sp_slot : slots_to_remove)
+			slots.remove(*sp_slot);
+	}
+
+	namespace priv
+	{
+		// MPSC (Multiple Producer Single Consumer) Lock-Free Queue
+		// Only ONE consumer thread is allowed to pop elements from the queue
+		template<typename T>
+		class MPSC_lock_free_queue
+		{
+		private:
+			struct alignas(std::hardware_constructive_interference_size) Node
+			{
+				T data;
+				std::atomic<Node*> next;
+				int numa_node;			///< Node the memory was allocated on (-1: global allocator).
+				Node(T value, int numa_node) : data(std::move(value)), next(nullptr), numa_node(numa_node) {}
+			};
+
+			// cache line size alignment to avoid false sharing
+			alignas(std::hardware_constructive_interference_size) std::atomic<Node*> m_head;
+			alignas(std::hardware_constructive_interference_size) std::atomic<Node*> m_tail;
+			std::atomic<int> m_numa_node{ -1 };
+
+			Node* create_node(T&& value)
+			{
+#ifdef SISL_NUMA_AWARE
+				// Allocated by the producer, but on the node of the consumer which reads it
+				const int numa_node = m_numa_node.load(std::memory_order_relaxed);
+				if (numa_node >= 0)
+					return new (allocate_on_node(sizeof(Node), numa_node)) Node(std::move(value), numa_node);
+#endif
+				return new (SISL_ALLOCATOR::allocate(sizeof(Node), alignof(Node))) Node(std::move(value), -1);
+			}
+
+			static void destroy_node(Node* p_node) noexcept
+			{
+#ifdef SISL_NUMA_AWARE
+				if (p_node->numa_node >= 0)
+				{
+					const int numa_node = p_node->numa_node;
+					p_node->~Node();
+					deallocate_on_node(p_node, sizeof(Node), numa_node);
+					return;
+				}
+#endif
+				p_node->~Node();
+				SISL_ALLOCATOR::deallocate(p_node, sizeof(Node), alignof(Node));
+			}
+
+		public:
+			MPSC_lock_free_queue()
+			{
+				Node* dummy = create_node(T{});
+				m_head.store(dummy, std::memory_order_relaxed);
+				m_tail.store(dummy, std::memory_order_relaxed);
+			}
+			~MPSC_lock_free_queue()
+			{
+				Node* current_node = m_head.load(std::memory_order_relaxed);
+				while (current_node)
+				{
+					Node* next_node = current_node->next.load(std::memory_order_relaxed);
+					destroy_node(current_node);
+					current_node = next_node;
+				}
+			}
+			// Wait-free for the producers: a producer only touches the node it has just unlinked from the tail,
+			// which the consumer cannot release before its next pointer is published.
+			bool push(T value)
+			{
+				Node* new_node = create_node(std::move(value));
+				Node* old_tail = m_tail.exchange(new_node, std::memory_order_acq_rel);
+				// seq_cst: the wake-up handshake of the consumer orders this publication with its m_waiting flag (see async_delegates::wake_up())
+				old_tail->next.store(new_node, std::memory_order_seq_cst);
+				return true;
+			}
+
+			bool pop(T& value) noexcept
+			{
+				Node* old_head = m_head.load(std::memory_order_relaxed);
+				Node* next_node = old_head->next.load(std::memory_order_acquire);
+				if (next_node == nullptr)
+				{
+					return false;
+				}
+				value = std::move(next_node->data);
+				m_head.store(next_node, std::memory_order_relaxed);
+				destroy_node(old_head);
+				return true;
+			}
+
+			// A push in progress (tail exchanged but not yet linked) is seen as empty until it is published.
+			// seq_cst: pairs with the publication of push() in the wake-up handshake.
+			bool empty() const
+			{
+				Node* head = m_head.load(std::memory_order_relaxed);
+				Node* next_node = head->next.load(std::memory_order_seq_cst);
+				return next_node == nullptr;
+			}
+
+			// The next nodes are allocated on this NUMA node (see SISL_NUMA_AWARE), set by the consumer.
+			void set_numa_node(int numa_node) noexcept
+			{
+				m_numa_node.store(numa_node, std::memory_order_relaxed);
+			}
+
+			int get_numa_node() const noexcept
+			{
+				return m_numa_node.load(std::memory_order_relaxed);
+			}
+		};
+
+		// BETA
+		// MPSC (Multiple Producer Single Consumer) Lock-Free Ring Queue
+		// Only ONE consumer thread is allowed to pop elements from the queue
+		// This is a fixed-size ring-queue, push will fail if the queue is full.
+		// Faster than MPSC_lock_free_queue because it uses a fixed-size array and no dynamic memory allocation.
+		template<typename T, std::size_t CAPACITY>
+		class MPSC_lock_free_ring_queue
+		{
+		private:
+			struct alignas(std::hardware_constructive_interference_size) Node
+			{
+				T data;
+				std::atomic<bool> is_valid;
+			};
+			alignas(std::hardware_constructive_interference_size) std::array<Node, CAPACITY> m_nodes;
+			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_head;
+			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_tail;
+
+		public:
+			MPSC_lock_free_ring_queue()
+			{
+				m_head.store(0, std::memory_order_relaxed);
+				m_tail.store(0, std::memory_order_relaxed);
+				for (auto& node : m_nodes)
+				{
+					node.is_valid.store(false, std::memory_order_relaxed);
+				}
+			}
+			bool push(T value)
+			{
+				size_t old_tail = 0;
+				size_t new_tail = 0;
+				do
+				{
+					old_tail = m_tail.load(std::memory_order_acquire);
+					new_tail = (old_tail + 1) % CAPACITY;
+					if (new_tail == m_head.load(std::memory_order_acquire))
+					{
+						return false; // Queue is full
+					}
+				} while (!m_tail.compare_exchange_weak(old_tail, new_tail, std::memory_order_seq_cst, std::memory_order_relaxed)); // seq_cst: see empty()
+				m_nodes[old_tail].data = std::move(value);
+				m_nodes[old_tail].is_valid.store(true, std::memory_order_release);
+				return true;
+			}
+			bool pop(T& value) noexcept
+			{
+				size_t old_head = m_head.load(std::memory_order_acquire);
+				if (old_head == m_tail.load(std::memory_order_acquire))
+				{
+					return false; // Queue is empty
+				}
+				if (!m_nodes[old_head].is_valid.load(std::memory_order_acquire))
+				{
+					return false; // The node is not valid, this can happen if the node was not pushed yet.
+				}
+				value = std::move(m_nodes[old_head].data);
+				m_nodes[old_head].is_valid.store(false, std::memory_order_release);
+				m_head.store((old_head + 1) % CAPACITY, std::memory_order_release);
+				return true;
+			}
+			// seq_cst: pairs with the reservation of push() in the wake-up handshake (see async_delegates::wake_up()).
+			bool empty() const
+			{
+				return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_seq_cst);
+			}
+
+			// The storage of the ring is allocated with the queue, it doesn't follow its consumer.
+			void set_numa_node(int) noexcept {}
+			int get_numa_node() const noexcept { return -1; }
+		};
+	}
+
+	template<typename TSENDER>
+	TSENDER* sender() { return priv::gtl_current_sender ? static_cast<TSENDER*>(priv::gtl_current_sender) : nullptr; }
+}
+// <=====================================================================================>
+// <=============				  Statics implementation					=============>
+// <=====================================================================================>
+
+#ifdef SISL_IMPLEMENTATION
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <deque>
+#include <cmath>
+#include <limits>
+
+#ifdef SISL_TRACING
+#include <fstream>
+#include <ostream>
+#endif // SISL_TRACING
+
+#ifdef __linux__
+#include <cerrno>
+#include <system_error>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif // __linux__
+
+#ifdef SISL_NUMA_AWARE
+#include <fstream>
+#include <string>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // SISL_NUMA_AWARE
+
+namespace SISL_NAMESPACE
+{
+	namespace priv
+	{
+		// The thread-local current sender.
+		thread_local void* gtl_current_sender = nullptr;
+		thread_local async_delegates* gtl_polled_queue = nullptr;
+
+		std::atomic<std::int64_t> g_slow_slot_threshold_ns{ 0 };
+
+		// Handler of the slow slot detector, copied by the threads reporting a slow slot.
+		struct slow_slot_detector
+		{
+			// Never destroyed: slots may still run during the static destruction.
+			static slow_slot_detector& instance()
+			{
+				static slow_slot_detector* instance = new slow_slot_detector();
+				return *instance;
+			}
+
+			std::mutex m_mtx;
+			std::shared_ptr<const std::function<void(const slow_slot_report&)>> m_sp_handler;
+		};
+
+		void report_if_slow_slot(std::chrono::steady_clock::time_point start, const void* signal, const delegate_info& info)
+		{
+			const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+			if (duration.count() < g_slow_slot_threshold_ns.load(std::memory_order_relaxed))
+				return;
+			std::shared_ptr<const std::function<void(const slow_slot_report&)>> sp_handler;
+			{
+				slow_slot_detector& detector = slow_slot_detector::instance();
+				std::lock_guard lock(detector.m_mtx);
+				sp_handler = detector.m_sp_handler;
+			}
+			if (sp_handler)
+				(*sp_handler)({ signal, info.owner, reinterpret_cast<const void*>(info.object), info.thread_affinity, info.type, duration });
+		}
+
+		// Size-class pool for the callables that don't fit in a delegate's inline storage.
+		// Freed blocks are kept in a free list per size class and recycled by the next allocations of the same class.
+		// Blocks bigger than the largest class are directly forwarded to the global allocator.
+		struct delegate_storage_pool
+		{
+			static constexpr std::size_t min_class_size = 64;
+			static constexpr std::size_t nb_classes = 5; // 64, 128, 256, 512, 1024 bytes
+
+			struct free_block
+			{
+				free_block* next;
+			};
+
+			struct size_class
+			{
+				std::mutex mtx;
+				free_block* head = nullptr;
+			};
+
+			// Never destroyed: slots of static signals may still release their blocks during static destruction.
+			static delegate_storage_pool& instance()
+			{
+				static delegate_storage_pool* instance = new delegate_storage_pool();
+				return *instance;
+			}
+
+			static std::size_t class_index(std::size_t size) noexcept
+			{
+				std::size_t index = 0;
+				for (std::size_t class_size = min_class_size; class_size < size; class_size <<= 1)
+					++index;
+				return index;
+			}
+
+			void* allocate(std::size_t size)
+			{
+				const std::size_t index = class_index(size);
+				if (index >= nb_classes)
+					return ::operator new(size);
+				{
+					std::lock_guard lock(m_classes[index].mtx);
+					if (free_block* block = m_classes[index].head)
+					{
+						m_classes[index].head = block->next;
+						return block;
+					}
+				}
+				return ::operator new(min_class_size << index);
+			}
+
+			void deallocate(void* p_block, std::size_t size) noexcept
+			{
+				const std::size_t index = class_index(size);
+				if (index >= nb_classes)
+				{
+					::operator delete(p_block);
+					return;
+				}
+				std::lock_guard lock(m_classes[index].mtx);
+				m_classes[index].head = new (p_block) free_block{ m_classes[index].head };
+			}
+
+			std::array<size_class, nb_classes> m_classes;
+		};
+
+#ifdef SISL_NUMA_AWARE
+		// NUMA topology read from sysfs: the node of each CPU.
+		struct numa_topology
+		{
+			static const numa_topology& instance()
+			{
+				static const numa_topology* instance = new numa_topology();
+				return *instance;
+			}
+
+			numa_topology()
+			{
+				for (int node : read_list("/sys/devices/system/node/online"))
+				{
+					m_nb_nodes = std::max(m_nb_nodes, node + 1);
+					for (int cpu : read_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))
+					{
+						if (cpu >= static_cast<int>(m_cpu_nodes.size()))
+							m_cpu_nodes.resize(cpu + 1, 0);
+						m_cpu_nodes[cpu] = node;
+					}
+				}
+			}
+
+			// Parses a sysfs list ("0-3,8-11")
+			static std::vector<int> read_list(const std::string& path)
+			{
+				std::vector<int> values;
+				std::ifstream file(path);
+				std::string range;
+				while (std::getline(file, range, ','))
+				{
+					const std::size_t dash = range.find('-');
+					try
+					{
+						const int first = std::stoi(range.substr(0, dash));
+						const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+						for (int value = first; value <= last; ++value)
+							values.push_back(value);
+					}
+					catch (const std::exception&)
+					{
+					}
+				}
+				return values;
+			}
+
+			int node_of_cpu(int cpu) const noexcept
+			{
+				return cpu >= 0 && cpu < static_cast<int>(m_cpu_nodes.size()) ? m_cpu_nodes[cpu] : 0;
+			}
+
+			std::vector<int> m_cpu_nodes;
+			int m_nb_nodes = 1;
+		};
+
+		std::atomic<std::uint64_t> g_numa_bind_failures{ 0 };
+
+		// Maps a chunk of memory aligned on its size and bound to a NUMA node.
+		// If the binding fails (no permission, offline node), the chunk is still usable, just not bound: the failure is counted (see numa_bind_failures).
+		std::byte* map_node_chunk(std::size_t size, int node)
+		{
+			static constexpr unsigned long mpol_bind = 2; // MPOL_BIND of <linux/mempolicy.h>
+			// Maps twice the size to align the chunk, then gives back the extra pages
+			void* p_mapping = ::mmap(nullptr, 2 * size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p_mapping == MAP_FAILED)
+				throw std::bad_alloc();
+			std::byte* p_begin = static_cast<std::byte*>(p_mapping);
+			std::byte* p_chunk = reinterpret_cast<std::byte*>((reinterpret_cast<std::uintptr_t>(p_begin) + size - 1) & ~(size - 1));
+			if (p_chunk != p_begin)
+				::munmap(p_begin, p_chunk - p_begin);
+			::munmap(p_chunk + size, p_begin + size - p_chunk);
+			unsigned long node_mask[16] = {};
+			node_mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+			if (::syscall(SYS_mbind, p_chunk, size, mpol_bind, node_mask, 8 * sizeof(node_mask), 0) != 0)
+				g_numa_bind_failures.fetch_add(1, std::memory_order_relaxed);
+			return p_chunk;
+		}
+#endif // SISL_NUMA_AWARE
+
+		// Pools of a thread for thread_pool_allocator, one per size class.
+		// The blocks are carved from chunks aligned on their size: the header of a chunk (found by masking the address of a block)
+		// gives the pool owning the block, so a block released by another thread is pushed on the remote-free list of its owner.
+		// With SISL_NUMA_AWARE, the heap also has pools per NUMA node, whose chunks are bound to the node (see allocate_on_node).
+		struct thread_heap
+		{
+			static constexpr std::size_t min_class_size = 32;
+			static constexpr std::size_t nb_classes = 7; // 32, 64, 128, 256, 512, 1024, 2048 bytes
+			static constexpr std::size_t chunk_size = 64 * 1024;
+
+			struct free_block
+			{
+				free_block* next;
+			};
+
+			struct chunk_header
+			{
+				thread_heap* p_owner;
+			};
+
+			struct size_class
+			{
+				free_block* local = nullptr;		///< Blocks released by the owner thread (owner only).
+				std::byte* p_next = nullptr;		///< Next block never allocated in the current chunk (owner only).
+				std::byte* p_end = nullptr;
+			};
+
+			struct pools
+			{
+				std::array<size_class, nb_classes> classes;
+				alignas(std::hardware_constructive_interference_size) std::array<std::atomic<free_block*>, nb_classes> remote{};
+			};
+
+			static std::size_t class_index(std::size_t size) noexcept
+			{
+				std::size_t index = 0;
+				for (std::size_t class_size = min_class_size; class_size < size; class_size <<= 1)
+					++index;
+				return index;
+			}
+
+			// A negative node allocates from the global allocator.
+			void* allocate(std::size_t index, int node = -1)
+			{
+				pools& owned = pools_of(node);
+				size_class& pool = owned.classes[index];
+				if (free_block* p_block = pool.local)
+				{
+					pool.local = p_block->next;
+					return p_block;
+				}
+				// Takes back all the blocks released by the other threads at once
+				if (free_block* p_block = owned.remote[index].exchange(nullptr, std::memory_order_acquire))
+				{
+					pool.local = p_block->next;
+					return p_block;
+				}
+				const std::size_t block_size = min_class_size << index;
+				if (pool.p_next == pool.p_end)
+				{
+					// The first block of a chunk holds its header
+					std::byte* p_chunk = new_chunk(node);
+					new (p_chunk) chunk_header{ this };
+					pool.p_next = p_chunk + block_size;
+					pool.p_end = p_chunk + chunk_size;
+				}
+				void* p_block = pool.p_next;
+				pool.p_next += block_size;
+				return p_block;
+			}
+
+			void release_local(void* p_block, std::size_t index, int node = -1) noexcept
+			{
+				size_class& pool = pools_of(node).classes[index];
+				pool.local = new (p_block) free_block{ pool.local };
+			}
 
-	/**
-	* @brief Disconnects a specific slot connected to this signal.
-	* 
-	* @param signal Reference to the signal.
-	* @param instance Reference to the receiver object.
-	* @param method Pointer to the member function.
-	*/
-	template<typename... TARGS, typename TINSTANCE, typename TMETHOD>
-	void disconnect(signal<TARGS...>& signal, const TINSTANCE& instance, TMETHOD method)
-	{
-		signal.disconnect(instance, method);
-	}
+			void release_remote(void* p_block, std::size_t index, int node = -1) noexcept
+			{
+				std::atomic<free_block*>& remote = pools_of(node).remote[index];
+				free_block* p_free = new (p_block) free_block{ remote.load(std::memory_order_relaxed) };
+				while (!remote.compare_exchange_weak(p_free->next, p_free, std::memory_order_release, std::memory_order_relaxed))
+				{
+				}
+			}
 
-	/**
-	* @brief Disconnects all slots owned by an object from this member signal.
-	*
-	* @param owner Reference to the object owning the signal.
-	* @param signal Member address of the signal (exemple : &COwner::my_signal)
-	* @param object Reference to the object whose slots should be disconnected.
-	*/
-	template<typename... TARGS, typename TOWNER, typename TOBJECT>
-	requires (!std::is_member_function_pointer_v<TOBJECT>)
-	void disconnect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, const TOBJECT& object)
-	{
-		(owner.*signal).disconnect(object);
-	}
+			static thread_heap* owner_of(void* p_block) noexcept
+			{
+				return reinterpret_cast<chunk_header*>(reinterpret_cast<std::uintptr_t>(p_block) & ~(chunk_size - 1))->p_owner;
+			}
 
-	/**
-	* @brief Disconnects all slots owned by an object from this signal.
-	* 
-	* @param signal Reference to the signal.
-	* @param object Reference to the object whose slots should be disconnected.
-	*/
-	template<typename... TARGS, typename TOBJECT>
-	requires (!std::is_member_function_pointer_v<TOBJECT>)
-	void disconnect(signal<TARGS...>& signal, const TOBJECT& object)
-	{
-		signal.disconnect(object);
-	}
+#ifdef SISL_NUMA_AWARE
+			// The pools of the nodes are created by the owner before its first allocation on a node,
+			// the other threads only reach them by releasing a block of the owner (received through a queue).
+			pools& pools_of(int node)
+			{
+				if (node < 0)
+					return m_pools;
+				if (!m_node_pools)
+					m_node_pools = std::make_unique<pools[]>(numa_topology::instance().m_nb_nodes);
+				return m_node_pools[node];
+			}
 
-	/**
-	* @brief Disconnects all slots relying on a specific method from this member signal.
-	* 
-	* @param owner Reference to the object owning the signal.
-	* @param signal Member address of the signal (exemple : &COwner::my_signal)
-	* @param method Member function pointer to disconnect.
-	*/
-	template<typename... TARGS, typename TOWNER, typename TMETHOD>
-	requires (std::is_member_function_pointer_v<TMETHOD>)
-	void disconnect(TOWNER& owner, signal<TARGS...> TOWNER::* signal, TMETHOD method)
-	{
-		(owner.*signal).disconnect(method);
-	}
+			static std::byte* new_chunk(int node)
+			{
+				if (node >= 0)
+					return map_node_chunk(chunk_size, node);
+				return static_cast<std::byte*>(::operator new(chunk_size, std::align_val_t(chunk_size)));
+			}
 
-	/**
-	* @brief Disconnects all slots relying on a specific method from this signal.
-	*
-	* @param signal Reference to the signal.
-	* @param method Member function pointer to disconnect.
-	*/
-	template<typename... TARGS, typename TMETHOD>
-	requires (std::is_member_function_pointer_v<TMETHOD>)
-	void disconnect(signal<TARGS...>& signal, TMETHOD method)
-	{
-		signal.disconnect(method);
-	}
+			std::unique_ptr<pools[]> m_node_pools;
+#else
+			pools& pools_of(int) noexcept
+			{
+				return m_pools;
+			}
 
-	template<typename T>
-	using lvalue_reference_if_value_t = std::conditional_t<std::is_reference_v<T>, T, const T&>;
+			static std::byte* new_chunk(int)
+			{
+				return static_cast<std::byte*>(::operator new(chunk_size, std::align_val_t(chunk_size)));
+			}
+#endif // SISL_NUMA_AWARE
 
-	/**
-	* @class signal
-	* @brief Represents a signal that can notify connected slots.
-	*
-	* The `signal` class encapsulates zero or more connected slots (functors, methods, or functions)
-	* and can emit events to all connected receivers.
-	*
-	* @tparam TARGS Argument types accepted by this signal.
-	*/
-	template<typename... TARGS>
-	class signal
-	{
-	public:
-		signal() = default;
-	
-		/**
-		* @brief The copy of a signal does not copy the slots.
-		*/
-		signal(const signal&) {}
+			pools m_pools;
+			std::atomic_bool in_use{ true };
+			thread_heap* next = nullptr;
+		};
 
-		/**
-		* @brief Move constructor for the signal.
-		*/
-		signal(signal&&) noexcept {}
+		// Registry of the thread heaps: a lock-free push-only list, the heaps of exited threads are reused (with their free blocks).
+		std::atomic<thread_heap*> g_thread_heaps{ nullptr };
+		thread_local thread_heap* gtl_thread_heap = nullptr;
 
-		/**
-		* @brief No affectation constructor.
-		*/
-		signal& operator=(const signal&) = delete;
+		// Releases the heap of a thread when it exits.
+		struct thread_heap_owner
+		{
+			~thread_heap_owner()
+			{
+				if (gtl_thread_heap)
+				{
+					gtl_thread_heap->in_use.store(false, std::memory_order_release);
+					gtl_thread_heap = nullptr;
+				}
+			}
+		};
+		thread_local thread_heap_owner gtl_thread_heap_owner;
 
-		/**
-		 * @brief Invokes all connected slots with the provided arguments.
-		 *
-		 * This method calls each connected slot with the given arguments, removing any single-shot slots
-		 * after they are invoked.
-		 *
-		 * @param args Arguments to pass to the connected slots.
-		 */
-		template<typename... UARGS>
-		void operator()(UARGS&&... args);
+		thread_heap& get_thread_heap()
+		{
+			if (gtl_thread_heap)
+				return *gtl_thread_heap;
+			(void)&gtl_thread_heap_owner; // Registers the release of the heap at thread exit
+			for (thread_heap* p_heap = g_thread_heaps.load(std::memory_order_acquire); p_heap; p_heap = p_heap->next)
+			{
+				bool expected = false;
+				if (!p_heap->in_use.load(std::memory_order_relaxed) && p_heap->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+				{
+					gtl_thread_heap = p_heap;
+					return *p_heap;
+				}
+			}
+			thread_heap* p_heap = new thread_heap();
+			p_heap->next = g_thread_heaps.load(std::memory_order_relaxed);
+			while (!g_thread_heaps.compare_exchange_weak(p_heap->next, p_heap, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+			gtl_thread_heap = p_heap;
+			return *p_heap;
+		}
 
-	private:
-		
-		template<typename... UARGS>
-		void emit_impl(UARGS&&... args);
+		// Registry of the hazard records: a lock-free push-only list, the records of exited threads are recycled.
+		std::atomic<hazard_record*> g_hazard_records{ nullptr };
+		thread_local hazard_record* gtl_hazard_record = nullptr;
 
-		template<typename TINSTANCE, typename TMETHOD>
-		requires priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>
-		void connect(void* owner, TINSTANCE& instance, TMETHOD method, std::thread::id thread_affinity, type_connection type)
+		// Releases the hazard record of a thread when it exits.
+		struct hazard_record_owner
+		{
+			~hazard_record_owner()
+			{
+				if (gtl_hazard_record)
+				{
+					gtl_hazard_record->in_use.store(false, std::memory_order_release);
+					gtl_hazard_record = nullptr;
+				}
+			}
+		};
+		thread_local hazard_record_owner gtl_hazard_record_owner;
+
+		hazard_record& get_hazard_record()
 		{
-			connect_to_instance_impl(owner, instance, method, thread_affinity, type);
+			if (gtl_hazard_record)
+				return *gtl_hazard_record;
+			(void)&gtl_hazard_record_owner; // Registers the release of the record at thread exit
+			for (hazard_record* p_record = g_hazard_records.load(std::memory_order_acquire); p_record; p_record = p_record->next)
+			{
+				bool expected = false;
+				if (!p_record->in_use.load(std::memory_order_relaxed) && p_record->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+				{
+					gtl_hazard_record = p_record;
+					return *p_record;
+				}
+			}
+			hazard_record* p_record = new hazard_record();
+			p_record->next = g_hazard_records.load(std::memory_order_relaxed);
+			while (!g_hazard_records.compare_exchange_weak(p_record->next, p_record, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+			gtl_hazard_record = p_record;
+			return *p_record;
 		}
 
-		template<typename TINSTANCE, typename TMETHOD>
-		requires priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>
-		void connect(void* owner, std::shared_ptr<TINSTANCE>& instance, TMETHOD method, std::thread::id thread_affinity, type_connection type)
+		void wait_for_hazards(const void* p_tracker)
 		{
-			connect_to_instance_impl(owner, instance, method, thread_affinity, type);
+			// The current thread may be destroying the receiver from one of its slots, it must not wait for itself.
+			const hazard_record* p_own_record = gtl_hazard_record;
+			for (hazard_record* p_record = g_hazard_records.load(std::memory_order_acquire); p_record; p_record = p_record->next)
+			{
+				if (p_record == p_own_record)
+					continue;
+				for (const auto& hazard : p_record->hazards)
+				{
+					while (hazard.load(std::memory_order_seq_cst) == p_tracker)
+						std::this_thread::yield();
+				}
+				while (true)
+				{
+					std::unique_lock lock(p_record->overflow_mtx);
+					if (std::find(p_record->overflow.begin(), p_record->overflow.end(), p_tracker) == p_record->overflow.end())
+						break;
+					lock.unlock();
+					std::this_thread::yield();
+				}
+			}
 		}
 
-		template<typename TINSTANCE, typename TMETHOD>
-		void connect_to_instance_impl(void* owner, TINSTANCE& instance, TMETHOD method, std::thread::id thread_affinity, type_connection type);
+#ifdef SISL_NUMA_AWARE
+		// The blocks bound to a node are pooled in the heap of the allocating thread, like thread_pool_allocator:
+		// a block released by the consumer of a queue goes back to the remote-free list of the emitter, without lock.
+		void* allocate_on_node(std::size_t size, int node)
+		{
+			const std::size_t index = thread_heap::class_index(size);
+			if (node < 0 || node >= numa_topology::instance().m_nb_nodes || index >= thread_heap::nb_classes)
+				return ::operator new(size);
+			return get_thread_heap().allocate(index, node);
+		}
 
-		template<typename TFUNCTOR>
-		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
-		void connect(void* owner, TFUNCTOR&& functor, std::thread::id thread_affinity, type_connection type);
+		void deallocate_on_node(void* p_block, std::size_t size, int node) noexcept
+		{
+			const std::size_t index = thread_heap::class_index(size);
+			if (node < 0 || node >= numa_topology::instance().m_nb_nodes || index >= thread_heap::nb_classes)
+			{
+				::operator delete(p_block);
+				return;
+			}
+			thread_heap* p_owner = thread_heap::owner_of(p_block);
+			if (p_owner == gtl_thread_heap)
+				p_owner->release_local(p_block, index, node);
+			else
+				p_owner->release_remote(p_block, index, node);
+		}
 
-		template<typename TFUNCTION>
-		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
-		void connect(void* owner, TFUNCTION&& function, std::thread::id thread_affinity, type_connection type);
+		int current_numa_node() noexcept
+		{
+			return numa_topology::instance().node_of_cpu(::sched_getcpu());
+		}
+#endif // SISL_NUMA_AWARE
 
-		template<typename TINSTANCE, typename TMETHOD>
-		requires (!priv::COMPATIBLE_METHOD_OF<TMETHOD, TINSTANCE, TARGS...>)
-		void connect(void*, TINSTANCE&, TMETHOD, std::thread::id, type_connection)
-		{ 
-			static_assert(sizeof(TINSTANCE) == 0, "[SISL] connect(): The provided method is not a member of the given object type or its argument types are incompatible with the signal's expected argument types.");
+		void* allocate_delegate_storage(std::size_t size)
+		{
+			return delegate_storage_pool::instance().allocate(size);
 		}
 
-		template<typename TFUNCTOR>
-		requires (priv::is_functor_v<TFUNCTOR> && !priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
-		void connect(void*, TFUNCTOR&&, type_connection type = type_connection::automatic)
+		void deallocate_delegate_storage(void* p_block, std::size_t size) noexcept
 		{
-			static_assert(sizeof(TFUNCTOR) == 0, "[SISL] connect(): The provided functor's argument types are incompatible with the signal's expected argument types.");
+			delegate_storage_pool::instance().deallocate(p_block, size);
 		}
+	}
 
-		template<typename TFUNCTION>
-		requires (std::is_function_v<std::remove_pointer_t<TFUNCTION>> && !priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
-		void connect(void*, TFUNCTION&&, type_connection type = type_connection::automatic)
+	void* thread_pool_allocator::allocate(std::size_t size, std::size_t alignment)
+	{
+		// The blocks are aligned on their class size
+		const std::size_t index = priv::thread_heap::class_index(std::max(size, alignment));
+		if (index >= priv::thread_heap::nb_classes)
+			return heap_allocator::allocate(size, alignment);
+		return priv::get_thread_heap().allocate(index);
+	}
+
+	void thread_pool_allocator::deallocate(void* p_block, std::size_t size, std::size_t alignment) noexcept
+	{
+		const std::size_t index = priv::thread_heap::class_index(std::max(size, alignment));
+		if (index >= priv::thread_heap::nb_classes)
 		{
-			static_assert(sizeof(TFUNCTION) == 0, "[SISL] connect(): The provided function's argument types are incompatible with the signal's expected argument types.");
+			heap_allocator::deallocate(p_block, size, alignment);
+			return;
 		}
+		priv::thread_heap* p_owner = priv::thread_heap::owner_of(p_block);
+		if (p_owner == priv::gtl_thread_heap)
+			p_owner->release_local(p_block, index);
+		else
+			p_owner->release_remote(p_block, index);
+	}
 
-		void disconnect_all();
+#ifdef SISL_NUMA_AWARE
+	std::uint64_t numa_bind_failures() noexcept
+	{
+		return priv::g_numa_bind_failures.load(std::memory_order_relaxed);
+	}
+#endif // SISL_NUMA_AWARE
 
-		template<typename TINSTANCE, typename TMETHOD>
-		void disconnect(TINSTANCE& instance, TMETHOD method);
+	namespace priv
+	{
+#ifdef SISL_INSTRUMENTATION
+		// Queueing delays of the calls invoked from a queue.
+		// Only written by the thread polling the queue (a queue has one consumer at a time), read by any thread without lock.
+		struct latency_recorder
+		{
+			void record(std::uint64_t ns) noexcept
+			{
+				auto& bucket = m_buckets[latency_histogram::bucket_of(ns)];
+				bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
 
-		template<typename TOBJECT>
-		requires (!std::is_member_function_pointer_v<TOBJECT>)
-		void disconnect(const TOBJECT& instance);
+			latency_histogram read() const noexcept
+			{
+				latency_histogram histogram;
+				for (std::size_t i = 0; i < latency_histogram::nb_buckets; ++i)
+					histogram.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+				return histogram;
+			}
 
-		template<typename TMETHOD>
-		requires (std::is_member_function_pointer_v<TMETHOD>)
-		void disconnect(TMETHOD method);
+			std::array<std::atomic<std::uint64_t>, latency_histogram::nb_buckets> m_buckets{};
+		};
+#endif // SISL_INSTRUMENTATION
 
-		template<typename... UARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
-		friend void connect(TOWNER&, signal<UARGS...> TOWNER::*, TINSTANCE&, TMETHOD, std::thread::id, type_connection);
+#ifdef SISL_USE_LOCK_FREE_RING_QUEUE
+		using lock_free_queue = MPSC_lock_free_ring_queue<queued_call, SISL_MAX_SLOTS_LOCK_FREE_RING_QUEUE>; // Example capacity, can be adjusted
+#else
+		using lock_free_queue = MPSC_lock_free_queue<queued_call>; // Default lock-free queue
+#endif
+		// A call of a pooled connection, never invoked by the thread that emitted it (see work_pool).
+		struct pooled_call
+		{
+			queued_call call;
+			std::thread::id emitter;
+		};
 
-		template<typename... UARGS, typename TINSTANCE, typename TMETHOD>
-		friend void connect(signal<UARGS...>&, TINSTANCE&, TMETHOD, std::thread::id, type_connection);
+		// A thread-safe queue for signals.
+		struct async_delegates
+		{
+			lock_free_queue m_queue;
+			lock_free_queue m_idle_queue;	///< Calls of the idle connections: only invoked when m_queue and the pool are empty.
+			std::mutex m_mtx_cv;
+			std::condition_variable m_cv;
+			std::atomic_bool m_terminated;
+			std::atomic<std::size_t> m_nb_pushing{ 0 };	///< Producers pushing into an event loop (see enqueue()), terminate() waits for them.
+			// Set while the consumer sleeps in poll(): the producers only take m_mtx_cv to wake it up.
+			std::atomic_bool m_waiting{ false };
+			bool m_owned = false;	///< Polled by a running thread (protected by the registry's shard lock).
+			std::atomic<std::thread::id> m_polling_thread;	///< Thread currently polling the queue (a queue has only one consumer at a time).
+			// Pooled calls emitted by the thread of the queue, run by the other workers (only for the threads polling with sisl::poll(), see work_pool).
+			bool m_is_worker = false;
+			std::mutex m_work_mtx;
+			std::deque<pooled_call> m_work;
+#ifdef __linux__
+			std::atomic<int> m_event_fd{ -1 };			///< Readable while calls are pending (see sisl::event_fd()), -1 until requested.
+			std::atomic_bool m_event_fd_set{ false };	///< The eventfd was written since the last poll: the next producers don't write it again.
+#endif // __linux__
+#ifdef SISL_INSTRUMENTATION
+			// Calls pending in m_queue and m_idle_queue: pushed minus popped, each side writes its own counter (see get_depth()).
+			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_nb_pushed{ 0 };
+			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_nb_popped{ 0 };	///< Only written by the consumer.
+			latency_recorder m_latency;
+#endif // SISL_INSTRUMENTATION
+
+			bool push(queued_call&& call, bool idle = false)
+			{
+				lock_free_queue& queue = idle ? m_idle_queue : m_queue;
+#ifdef SISL_INSTRUMENTATION
+				if (queue.push(std::move(call)))
+				{
+					m_nb_pushed.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+				__SISL_STATS_ADD(queue_full, 1);
+				return false;
+#else
+				return queue.push(std::move(call));
+#endif // SISL_INSTRUMENTATION
+			}
 
-		template<typename... UARGS, typename TOWNER, typename TFUNCTOR>
-		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, UARGS...>)
-		friend void connect(TOWNER&, signal<UARGS...> TOWNER::*, TFUNCTOR&&, std::thread::id, type_connection);
+			bool pop(queued_call& call, bool idle = false)
+			{
+				if (!(idle ? m_idle_queue : m_queue).pop(call))
+					return false;
+#ifdef SISL_INSTRUMENTATION
+				m_nb_popped.store(m_nb_popped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+#endif // SISL_INSTRUMENTATION
+				return true;
+			}
 
-		template<typename... UARGS, typename TFUNCTOR>
-		requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, UARGS...>)
-		friend void connect(signal<UARGS...>&, TFUNCTOR&&, std::thread::id, type_connection);
+#ifdef SISL_INSTRUMENTATION
+			// Approximate while producers and consumer run: a call popped right after its push may be seen popped before pushed.
+			std::size_t get_depth() const noexcept
+			{
+				const std::size_t nb_popped = m_nb_popped.load(std::memory_order_relaxed);
+				const std::size_t nb_pushed = m_nb_pushed.load(std::memory_order_relaxed);
+				return nb_pushed > nb_popped ? nb_pushed - nb_popped : 0;
+			}
+#endif // SISL_INSTRUMENTATION
 
-		template<typename... UARGS, typename TOWNER, typename TFUNCTION>
-		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, UARGS...>)
-		friend void connect(TOWNER&, signal<UARGS...> TOWNER::*, TFUNCTION&&, std::thread::id, type_connection);
+#ifdef __linux__
+			~async_delegates()
+			{
+				const int fd = m_event_fd.load(std::memory_order_relaxed);
+				if (fd >= 0)
+					::close(fd);
+			}
 
-		template<typename... UARGS, typename TFUNCTION>
-		requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, UARGS...>)
-		friend void connect(signal<UARGS...>&, TFUNCTION&&, std::thread::id, type_connection);
+			// Creates the eventfd on the first request, it is readable at once if calls are already pending.
+			int get_event_fd()
+			{
+				int fd = m_event_fd.load(std::memory_order_acquire);
+				if (fd >= 0)
+					return fd;
+				const int new_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+				if (new_fd < 0)
+					throw std::system_error(errno, std::generic_category(), "eventfd");
+				if (!m_event_fd.compare_exchange_strong(fd, new_fd, std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					::close(new_fd);
+					return fd;
+				}
+				signal_event_fd(true);
+				return new_fd;
+			}
 
-		template<typename... UARGS, typename TOWNER, typename TINSTANCE, typename TMETHOD>
-		friend void disconnect(TOWNER&, signal<UARGS...> TOWNER::*, const TINSTANCE&, TMETHOD);
+			// Makes the eventfd readable, a single write until the consumer resets it.
+			void signal_event_fd(bool only_if_pending = false)
+			{
+				const int fd = m_event_fd.load(std::memory_order_acquire);
+				if (fd < 0 || (only_if_pending && m_queue.empty() && m_idle_queue.empty()))
+					return;
+				if (!m_event_fd_set.exchange(true, std::memory_order_seq_cst))
+				{
+					const std::uint64_t one = 1;
+					[[maybe_unused]] const auto written = ::write(fd, &one, sizeof(one));
+				}
+			}
 
-		template<typename... UARGS, typename TINSTANCE, typename TMETHOD>
-		friend void disconnect(signal<UARGS...>&, const TINSTANCE&, TMETHOD);
+			// Called by the consumer before taking the calls: either it takes the calls of a producer, or the producer sees the reset and writes again.
+			void reset_event_fd()
+			{
+				const int fd = m_event_fd.load(std::memory_order_relaxed);
+				if (fd < 0)
+					return;
+				std::uint64_t value = 0;
+				[[maybe_unused]] const auto read = ::read(fd, &value, sizeof(value));
+				// seq_cst, like the publication of the calls: the next emptiness checks see the calls of a producer that saw the flag still set
+				m_event_fd_set.store(false, std::memory_order_seq_cst);
+			}
+#endif // __linux__
 
-		template<typename... UARGS, typename TOWNER, typename TOBJECT>
-		requires (!std::is_member_function_pointer_v<TOBJECT>)
-		friend void disconnect(TOWNER&, signal<UARGS...> TOWNER::*, const TOBJECT&);
+			void wake_up()
+			{
+				// The call was published by a seq_cst operation, and poll() sets m_waiting (seq_cst) before checking the queue:
+				// either the producer sees m_waiting, or the consumer sees the queued delegate.
+#ifdef __linux__
+				signal_event_fd();
+#endif // __linux__
+				if (m_waiting.load(std::memory_order_seq_cst))
+				{
+					// Taking the mutex ensures the consumer is either before its predicate check or waiting on the condition variable.
+					{ std::lock_guard lock(m_mtx_cv); }
+					m_cv.notify_one();
+				}
+			}
 
-		template<typename... UARGS, typename TOBJECT>
-		requires (!std::is_member_function_pointer_v<TOBJECT>)
-		friend void disconnect(signal<UARGS...>&, const TOBJECT&);
+			void terminate()
+			{
+				m_terminated.store(true, std::memory_order_seq_cst);
+				while (m_nb_pushing.load(std::memory_order_acquire) != 0)
+					std::this_thread::yield();
+				{ std::lock_guard lock(m_mtx_cv); }
+				m_cv.notify_all();
+#ifdef __linux__
+				// Wakes up the epoll_wait() of the consumer, its poll() returns terminated
+				signal_event_fd();
+#endif // __linux__
+			}
+
+			// Timers of the delayed emissions, in a min-heap on their deadlines.
+			// Only accessed by the thread polling the queue: the timers are scheduled by the polling thread itself (see schedule_timer()).
+			struct timer_entry
+			{
+				std::chrono::steady_clock::time_point deadline;
+				std::uint64_t sequence;	///< Timers of a same deadline fire in their scheduling order.
+				std::shared_ptr<timer_state> sp_timer;
+
+				bool operator>(const timer_entry& other) const noexcept
+				{
+					return deadline != other.deadline ? deadline > other.deadline : sequence > other.sequence;
+				}
+			};
+			std::vector<timer_entry> m_timers;
+			std::uint64_t m_timer_sequence = 0;
+
+			void add_timer(std::shared_ptr<timer_state> sp_timer, std::chrono::steady_clock::time_point deadline)
+			{
+				m_timers.push_back({ deadline, m_timer_sequence++, std::move(sp_timer) });
+				std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+			}
+
+			// Deadline of the nearest timer (time_point::max() if there is none), the stopped timers on top of the heap are dropped.
+			std::chrono::steady_clock::time_point next_deadline()
+			{
+				while (!m_timers.empty() && !m_timers.front().sp_timer->is_active())
+				{
+					std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+					m_timers.pop_back();
+				}
+				return m_timers.empty() ? std::chrono::steady_clock::time_point::max() : m_timers.front().deadline;
+			}
 
-		template<typename... UARGS, typename TOWNER, typename TMETHOD>
-		requires (std::is_member_function_pointer_v<TMETHOD>)
-		friend void disconnect(TOWNER&, signal<UARGS...> TOWNER::*, TMETHOD);
+			// Delay until the nearest timer, rounded up to the millisecond (blocking_polling if there is none).
+			std::chrono::milliseconds next_timer_delay()
+			{
+				const auto deadline = next_deadline();
+				if (deadline == std::chrono::steady_clock::time_point::max())
+					return blocking_polling;
+				const auto now = std::chrono::steady_clock::now();
+				return deadline <= now ? std::chrono::milliseconds(0) : std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+			}
 
-		template<typename... UARGS, typename TMETHOD>
-		requires (std::is_member_function_pointer_v<TMETHOD>)
-		friend void disconnect(signal<UARGS...>&, TMETHOD);
+			// Fires the timers due now, returns true if at least one emitted.
+			bool fire_timers()
+			{
+				if (m_timers.empty())
+					return false;
+				bool fired = false;
+				const auto now = std::chrono::steady_clock::now();
+				// The emissions may schedule new timers: the entry is taken out of the heap before firing it
+				while (next_deadline() <= now)
+				{
+					std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+					timer_entry entry = std::move(m_timers.back());
+					m_timers.pop_back();
+					const auto period = entry.sp_timer->m_period;
+					if (period > std::chrono::steady_clock::duration::zero())
+					{
+						// A late poll skips the missed periods
+						entry.deadline += period * ((now - entry.deadline) / period + 1);
+						add_timer(entry.sp_timer, entry.deadline);
+					}
+					entry.sp_timer->m_fire();
+					fired = true;
+				}
+				return fired;
+			}
+		};
 
-		template <typename... UARGS, typename TOWNER>
-		friend void disconnect_all(TOWNER&, signal<UARGS...> TOWNER::*);
+		// Registry of the signal queues, indexed by thread ID.
+		// Sharded by thread ID (one lock per shard) so registering threads and emitters targeting different threads don't contend.
+		// A queue is removed when its thread exits (if it has polled) or when its sisl::jthread is joined, so thread ids churned
+		// by thread pools don't leak, and a new thread reusing an id doesn't inherit a stale (terminated) queue.
+		// Entries are shared: an emitter may still push into the queue of an exiting thread, the delegate is then dropped with it.
+		struct hashmap_signal_queue
+		{
+			static constexpr std::size_t nb_shards = 16;
 
-		template<typename... UARGS>
-		friend void disconnect_all(signal<UARGS...>&);
-		
-		// Slots are stored within a unique_ptr because it's much smaller than a full vector
-		std::unique_ptr<std::vector<std::shared_ptr<priv::slot< lvalue_reference_if_value_t<TARGS>... >>>> m_slots;
-		// Mutex for the slots vector
-		mutable std::shared_mutex m_mtx;
+			struct alignas(std::hardware_constructive_interference_size) shard
+			{
+				std::unordered_map<std::thread::id, std::shared_ptr<async_delegates>> m_async_delegates;
+				std::shared_mutex m_mutex;
+			};
 
-		void init_slots_vector_if_necessary()
-		{
-			std::shared_lock lock_slots_read(m_mtx);
-			if (!m_slots)
+			// Never destroyed: detached threads may still exit (and deregister) during the static destruction.
+			static hashmap_signal_queue& instance()
 			{
-				lock_slots_read.unlock();
-				std::unique_lock lock_slots_write(m_mtx);
-				m_slots = std::make_unique<std::vector<std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>>>();
+				static hashmap_signal_queue* instance = new hashmap_signal_queue();
+				return *instance;
 			}
-		}
-	};
-}
 
-// <=====================================================================================>
-// <=============				Templates implementation					=============>
-// <=====================================================================================>
+			shard& get_shard(std::thread::id thread_id)
+			{
+				return m_shards[std::hash<std::thread::id>{}(thread_id) % nb_shards];
+			}
 
-namespace SISL_NAMESPACE
-{
-	namespace priv
-	{
-		extern thread_local void* gtl_current_sender;
-	}
+			// Queue of a thread, nullptr if it has none (doesn't create it).
+			std::shared_ptr<async_delegates> find_thread_queue(std::thread::id thread_id)
+			{
+				shard& shard = get_shard(thread_id);
+				std::shared_lock<std::shared_mutex> read_lock(shard.m_mutex);
+				auto it = shard.m_async_delegates.find(thread_id);
+				return it != shard.m_async_delegates.end() ? it->second : nullptr;
+			}
 
-	template<typename... TARGS>
-	template<typename TINSTANCE, typename TMETHOD>
-	void signal<TARGS...>::connect_to_instance_impl(void* owner, TINSTANCE& instance, TMETHOD method, std::thread::id thread_affinity, type_connection type)
-	{
-		init_slots_vector_if_necessary();
-		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&instance), typeid(method).hash_code(), thread_affinity, type };
-		if (type & type_connection::unique)
-		{
-			const auto it = std::find_if(m_slots->begin(), m_slots->end(), [&info](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
+			// Queue of a thread for a producer: if the thread hasn't polled yet, its queue is created and kept pending
+			// (at most SISL_MAX_PENDING_THREAD_QUEUES of them, see add_pending()) until the thread registers it.
+			std::shared_ptr<async_delegates> get_thread_queue(std::thread::id thread_id)
 			{
-				return slot->get_info().object == info.object && slot->get_info().function == info.function;
-			});
-			if (it != m_slots->end())
+				if (std::shared_ptr<async_delegates> sp_delegates = find_thread_queue(thread_id))
+					return sp_delegates;
+				shard& shard = get_shard(thread_id);
+				std::unique_lock<std::shared_mutex> write_lock(shard.m_mutex);
+				auto& sp_delegates = shard.m_async_delegates[thread_id];
+				if (sp_delegates)
+					return sp_delegates;
+				sp_delegates = std::make_shared<async_delegates>();
+				std::shared_ptr<async_delegates> sp_created = sp_delegates;
+				write_lock.unlock();
+				add_pending(thread_id);
+				return sp_created;
+			}
+
+			// Called by a thread on its first poll: the queue is then removed at the thread's exit.
+			std::shared_ptr<async_delegates> register_thread(std::thread::id thread_id)
 			{
-				// If the slot already exists, we do not add it again
-				return;
+				std::shared_ptr<async_delegates> sp_registered;
+				{
+					shard& shard = get_shard(thread_id);
+					std::unique_lock<std::shared_mutex> write_lock(shard.m_mutex);
+					auto& sp_delegates = shard.m_async_delegates[thread_id];
+					if (!sp_delegates)
+						sp_delegates = std::make_shared<async_delegates>();
+					sp_delegates->m_owned = true;
+					sp_registered = sp_delegates;
+				}
+				forget_pending(thread_id);
+				return sp_registered;
 			}
-		}
 
-		// if the target instance is managed by shared_ptr, we may have more secure delegate to create
-		if constexpr (priv::has_weak_from_this<TINSTANCE> || priv::is_shared_ptr_v<std::decay_t<TINSTANCE>>)
-		{
-			auto weak_instance = [&]() 
+			// Removes the queue of a thread: the given one (owned by an exiting thread), or any queue not owned by a thread if p_delegates is nullptr.
+			void remove(std::thread::id thread_id, const async_delegates* p_delegates)
 			{
-				if constexpr (priv::is_shared_ptr_v<std::decay_t<TINSTANCE>>) 
-					return std::weak_ptr(instance);
-				else 
-					return instance.weak_from_this();
-			}();
-			if (!weak_instance.expired())
+				std::shared_ptr<async_delegates> sp_removed; // Released after the unlock
+				{
+					shard& shard = get_shard(thread_id);
+					std::unique_lock<std::shared_mutex> write_lock(shard.m_mutex);
+					auto it = shard.m_async_delegates.find(thread_id);
+					if (it == shard.m_async_delegates.end())
+						return;
+					if (p_delegates ? it->second.get() != p_delegates : it->second->m_owned)
+						return;
+					sp_removed = std::move(it->second);
+					shard.m_async_delegates.erase(it);
+				}
+				if (!p_delegates)
+					forget_pending(thread_id);
+			}
+
+			void terminates(std::thread::id id)
 			{
-				auto callee = [weak_instance, method](auto&&... args) -> bool
+				if (id == std::thread::id())
 				{
-					if (auto shared_instance = weak_instance.lock())
+					for (auto& shard : m_shards)
 					{
-						(shared_instance.get()->*method)(args...);
-						return true; // Indicates successful call
+						std::shared_lock<std::shared_mutex> read_lock(shard.m_mutex);
+						for (const auto& [thread_id, delegates] : shard.m_async_delegates)
+						{
+							delegates->terminate();
+						}
 					}
-					else
+				}
+				else
+				{
+					shard& shard = get_shard(id);
+					std::shared_lock<std::shared_mutex> read_lock(shard.m_mutex);
+					auto it = shard.m_async_delegates.find(id);
+					if (it != shard.m_async_delegates.end())
 					{
-						return false; // Instance is no longer valid
+						it->second->terminate();
 					}
-				};
-				auto sp_callee = std::make_shared<priv::slot<lvalue_reference_if_value_t<TARGS>...>>(std::move(callee), info);
-				std::unique_lock lock_slots(m_mtx);
-				m_slots->emplace_back(std::move(sp_callee));
-				return;
+				}
 			}
-			return;
-		}
-		else
-		{
-			// otherwise we just call the method, no check
-			auto callee = [&instance, method](auto&&... args) -> bool
-			{
-				(instance.*method)(args...);
-				return true; // Indicates successful call
-			};
-			auto sp_callee = std::make_shared<priv::slot<lvalue_reference_if_value_t<TARGS>...>>(std::move(callee), info);
-			std::unique_lock lock_slots(m_mtx);
-			m_slots->emplace_back(std::move(sp_callee));
-		}
-	}
 
-	template<typename... TARGS>
-	template<typename TFUNCTOR>
-	requires (priv::COMPATIBLE_FUNCTOR<TFUNCTOR, TARGS...>)
-	void signal<TARGS...>::connect(void* owner, TFUNCTOR&& functor, std::thread::id thread_affinity, type_connection type)
-	{
-		init_slots_vector_if_necessary();
-		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&functor), 0, thread_affinity, type };
-		if (type & type_connection::unique)
-		{
-			const auto it = std::find_if(m_slots->begin(), m_slots->end(), [&info](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
+			std::array<shard, nb_shards> m_shards;
+
+		private:
+			// The queues created by producers for threads that haven't polled yet, oldest first: beyond SISL_MAX_PENDING_THREAD_QUEUES,
+			// the oldest one is dropped with its calls (its thread may have exited without polling, the registry can't know it).
+			void add_pending(std::thread::id thread_id)
 			{
-				return slot->get_info().object == info.object && slot->get_info().function == 0;
-			});
-			if (it != m_slots->end())
+				std::thread::id dropped;
+				{
+					std::lock_guard lock(m_pending_mtx);
+					m_pending.push_back(thread_id);
+					if (m_pending.size() <= max_pending_queues)
+						return;
+					dropped = m_pending.front();
+					m_pending.pop_front();
+				}
+				remove(dropped, nullptr); // Nothing to do if the thread registered its queue meanwhile
+			}
+
+			void forget_pending(std::thread::id thread_id)
 			{
-				// If the slot already exists, we do not add it again
-				return;
+				std::lock_guard lock(m_pending_mtx);
+				auto it = std::find(m_pending.begin(), m_pending.end(), thread_id);
+				if (it != m_pending.end())
+					m_pending.erase(it);
 			}
-		}
-		auto callee = [functor](auto&&... args) -> bool
-		{
-			functor(args...);
-			return true; // Indicates successful calls
+
+			static constexpr std::size_t max_pending_queues = SISL_MAX_PENDING_THREAD_QUEUES;
+			std::mutex m_pending_mtx;
+			std::deque<std::thread::id> m_pending;
 		};
-		auto sp_callee = std::make_shared<priv::slot<lvalue_reference_if_value_t<TARGS>...>>(std::move(callee), info);
-		std::unique_lock lock_slots(m_mtx);
-		m_slots->emplace_back(std::move(sp_callee));
-	}
 
-	template<typename... TARGS>
-	template<typename TFUNCTION>
-	requires (priv::COMPATIBLE_FUNCTION<TFUNCTION, TARGS...>)
-	void signal<TARGS...>::connect(void* owner, TFUNCTION&& function, std::thread::id thread_affinity, type_connection type)
-	{
-		init_slots_vector_if_necessary();
-		const priv::delegate_info info = { owner, reinterpret_cast<intptr_t>(&function), 0, thread_affinity, type };
-		if (type & type_connection::unique)
+		// Work-stealing pool of the pooled connections, shared by the threads polling with sisl::poll() and by the event loops (the workers).
+		// A pooled call never runs on the thread that emitted it: the calls emitted by a worker thread land in its own deque,
+		// which only the other workers steal from, the ones emitted by other threads in a shared injection queue.
+		// An idle worker takes from the injection queue (skipping the calls of its own thread), then steals from the deques of the other workers.
+		struct work_pool
 		{
-			const auto it = std::find_if(m_slots->begin(), m_slots->end(), [&info](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
+			// Never destroyed: workers may exit during the static destruction.
+			static work_pool& instance()
 			{
-				return slot->get_info().object == info.object && slot->get_info().function == 0;
-			});
-			if (it != m_slots->end())
-			{
-				// If the slot already exists, we do not add it again
-				return;
+				static work_pool* instance = new work_pool();
+				return *instance;
 			}
-		}
 
-		auto callee = [function](auto&&... args)->bool
-		{
-			function(args...);
-			return true; // Indicates successful call
-		};
-		auto sp_callee = std::make_shared<priv::slot<lvalue_reference_if_value_t<TARGS>...>>(std::move(callee), info);
-		std::unique_lock lock_slots(m_mtx);
-		m_slots->emplace_back(std::move(sp_callee));
-	}
-	
-	template<typename... TARGS>
-	void signal<TARGS...>::disconnect_all()
-	{
-		init_slots_vector_if_necessary();
-		std::unique_lock lock_slots(m_mtx);
-		m_slots->clear();
-	}
+			void add_worker(async_delegates& worker)
+			{
+				std::unique_lock lock(m_workers_mtx);
+				worker.m_is_worker = true;
+				m_workers.push_back(&worker);
+			}
 
-	template<typename... TARGS>
-	template<typename TINSTANCE, typename TMETHOD>
-	void signal<TARGS...>::disconnect(TINSTANCE& instance, TMETHOD method)
-	{
-		init_slots_vector_if_necessary();
-		std::unique_lock lock_slots(m_mtx);
-		std::erase_if(*m_slots, [&instance, method](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
-		{
-			return slot->m_info.object == reinterpret_cast<intptr_t>(&instance) && slot->m_info.function == typeid(method).hash_code();
-		});
-	}
+			// The calls left in the deque of an exiting worker are handed over to the other workers.
+			void remove_worker(async_delegates& worker)
+			{
+				{
+					std::unique_lock lock(m_workers_mtx);
+					m_workers.erase(std::find(m_workers.begin(), m_workers.end(), &worker));
+				}
+				std::deque<pooled_call> left_work;
+				{
+					std::lock_guard lock(worker.m_work_mtx);
+					left_work.swap(worker.m_work);
+				}
+				if (left_work.empty())
+					return;
+				{
+					std::lock_guard lock(m_injection_mtx);
+					for (auto& call : left_work)
+						m_injection.push_back(std::move(call));
+					m_nb_pushes.fetch_add(1, std::memory_order_seq_cst);
+				}
+				wake_up_one(nullptr);
+			}
 
-	template<typename... TARGS>
-	template<typename TOBJECT>
-	requires (!std::is_member_function_pointer_v<TOBJECT>)
-	void signal<TARGS...>::disconnect(const TOBJECT& instance)
-	{
-		init_slots_vector_if_necessary();
-		std::unique_lock lock_slots(m_mtx);
-		std::erase_if(*m_slots, [&instance](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
-		{
-			return slot->m_info.object == reinterpret_cast<intptr_t>(&instance);
-		});
-	}
+			// The pending counter is incremented under the lock of the deque: a thief can only take (and count) the call after it.
+			void push(queued_call&& call, async_delegates* p_local_worker)
+			{
+				std::mutex& mtx = p_local_worker ? p_local_worker->m_work_mtx : m_injection_mtx;
+				{
+					std::lock_guard lock(mtx);
+					(p_local_worker ? p_local_worker->m_work : m_injection).push_back({ std::move(call), std::this_thread::get_id() });
+					m_nb_pending.fetch_add(1, std::memory_order_relaxed);
+					m_nb_pushes.fetch_add(1, std::memory_order_seq_cst); // Publication of the call for the wake-up handshake (see wake_up_one())
+				}
+				wake_up_one(p_local_worker);
+			}
 
-	template<typename... TARGS>
-	template<typename TMETHOD>
-	requires (std::is_member_function_pointer_v<TMETHOD>)
-	void signal<TARGS...>::disconnect(TMETHOD method)
-	{
-		init_slots_vector_if_necessary();
-		std::unique_lock lock_slots(m_mtx);
-		std::erase_if(*m_slots, [method](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
-		{
-			return slot->m_info.function == typeid(method).hash_code();
-		});
-	}
+			bool take(async_delegates& worker, queued_call& call)
+			{
+				if (m_nb_pending.load(std::memory_order_relaxed) == 0)
+					return false;
+				const std::thread::id current_thread = std::this_thread::get_id();
+				if (pop_first_of_others(m_injection_mtx, m_injection, call, current_thread))
+					return true;
+				// Steals the oldest calls of the other workers, starting from a different worker each time to spread the thefts
+				// (the deque of the worker itself only holds the calls of its thread, unless it is an event loop)
+				std::shared_lock lock(m_workers_mtx);
+				const std::size_t nb_workers = m_workers.size();
+				const std::size_t first = m_next_victim.fetch_add(1, std::memory_order_relaxed);
+				for (std::size_t i = 0; i < nb_workers; ++i)
+				{
+					async_delegates* p_victim = m_workers[(first + i) % nb_workers];
+					if (p_victim != &worker && pop_first_of_others(p_victim->m_work_mtx, p_victim->m_work, call, current_thread))
+						return true;
+				}
+				return false;
+			}
 
-	template<typename... TARGS>
-	template<typename... UARGS>
-	void signal<TARGS...>::operator()(UARGS&&... args)
-	{
-		emit_impl(std::forward<UARGS>(args)...);
-	}
+			// Counter of the pushes: a worker that found no call it can take only wakes up for the next pushes (see poll_queue()).
+			std::uint64_t get_nb_pushes() const noexcept
+			{
+				return m_nb_pushes.load(std::memory_order_seq_cst);
+			}
 
-	template<typename... TARGS>
-	template<typename... UARGS>
-	void signal<TARGS...>::emit_impl(UARGS&&... args)
-	{
-		init_slots_vector_if_necessary();
-		const std::thread::id current_thread = std::this_thread::get_id();
-		// Copy the slot's array before looping on it (smaller contention than keeping a read-lock during the iteration)
-		std::vector<std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>> slots_copy;
-		std::vector<std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>> slots_to_remove;
-		{
-			std::unique_lock lock_slots(m_mtx);
-			if (m_slots->empty())
-				return;
-			slots_copy = *m_slots;
-		}
+			bool has_work(std::uint64_t nb_pushes_seen) const noexcept
+			{
+				// The push counter is read first: it is incremented after the pending counter
+				const std::uint64_t nb_pushes = m_nb_pushes.load(std::memory_order_seq_cst);
+				return nb_pushes != nb_pushes_seen && m_nb_pending.load(std::memory_order_relaxed) != 0;
+			}
 
-		// We use a shared_ptr to a tuple to avoid copying the arguments for each queued slot
-		std::shared_ptr<std::tuple<std::remove_reference_t<TARGS>...>> args_tuple;
+#ifdef SISL_INSTRUMENTATION
+			std::size_t get_nb_pending() const noexcept
+			{
+				return m_nb_pending.load(std::memory_order_relaxed);
+			}
+#endif // SISL_INSTRUMENTATION
 
-		for (auto& sp_slot : slots_copy)
-		{
-			auto& slot = *sp_slot;
-			const priv::delegate_info& info = slot.get_info();
-			const type_connection type_without_flags = get_type_connection_without_flags(info.type);
-			// Checks if the slot should be executed directly or queued
-			const bool must_queue =		type_without_flags == type_connection::queued
-									||	type_without_flags == type_connection::blocking_queued
-									||	type_without_flags == type_connection::automatic && info.thread_affinity != priv::get_empty_thread_id() && info.thread_affinity != current_thread;
-			
-			bool result = true;
-			if (must_queue)
+		private:
+			// Takes the oldest call not emitted by the current thread.
+			bool pop_first_of_others(std::mutex& mtx, std::deque<pooled_call>& work, queued_call& call, std::thread::id current_thread)
 			{
-				// We need to store the arguments in a tuple to be able to pass them to queued calls without copying them each time
-				if(!args_tuple)
-					args_tuple = std::make_shared<std::tuple<std::remove_reference_t<TARGS>...>>(args...);
+				std::lock_guard lock(mtx);
+				auto it = std::find_if(work.begin(), work.end(), [current_thread](const pooled_call& pooled) { return pooled.emitter != current_thread; });
+				if (it == work.end())
+					return false;
+				call = std::move(it->call);
+				work.erase(it);
+				m_nb_pending.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
 
-				const std::thread::id target_thread = info.thread_affinity == priv::get_empty_thread_id() ? current_thread : info.thread_affinity;
-				// if the slot is blocking_queued, we need to wait for the slot to finish
-				if (type_without_flags == type_connection::blocking_queued)
+			// Wakes up one sleeping worker other than p_emitter, the handshake with poll_queue() is the one of async_delegates::wake_up() (on m_nb_pushes).
+			// If none sleeps in poll(), the workers waiting on their eventfd are signaled instead.
+			void wake_up_one(async_delegates* p_emitter)
+			{
+				std::shared_lock lock(m_workers_mtx);
+				const std::size_t nb_workers = m_workers.size();
+				const std::size_t first = m_next_victim.load(std::memory_order_relaxed);
+				for (std::size_t i = 0; i < nb_workers; ++i)
 				{
-					// If we are in the same thread, with blocking_queued, we MUST throw an exception because it would cause a deadlock.
-					if (current_thread == target_thread)
+					async_delegates* p_worker = m_workers[(first + i) % nb_workers];
+					if (p_worker != p_emitter && p_worker->m_waiting.load(std::memory_order_seq_cst))
 					{
-						throw invalid_blocking_queued_connection();
+						{ std::lock_guard lock_cv(p_worker->m_mtx_cv); }
+						p_worker->m_cv.notify_one();
+						return;
 					}
-					std::promise<void> done;
-					auto future_done = done.get_future();
-					priv::enqueue([sp_slot, &done, args_tuple]() mutable
-					{
-						priv::gtl_current_sender = sp_slot->get_info().owner;
-						try
-						{
-							std::apply(*sp_slot.get(), *args_tuple);
-							done.set_value();
-						}
-						catch (...)
-						{
-							done.set_exception(std::current_exception());
-						}
-						priv::gtl_current_sender = nullptr;
-					}, target_thread);
-					future_done.wait();
 				}
-				// If the slot is queued, we just enqueue it
-				else
+#ifdef __linux__
+				for (async_delegates* p_worker : m_workers)
 				{
-					priv::enqueue([sp_slot, args_tuple]() mutable
-					{
-						priv::gtl_current_sender = sp_slot->get_info().owner;
-						std::apply(*sp_slot.get(), *args_tuple);
-						priv::gtl_current_sender = nullptr;
-					}, target_thread);
+					if (p_worker != p_emitter)
+						p_worker->signal_event_fd();
 				}
+#endif // __linux__
 			}
-			// If the slot is direct, we call it directly
-			else
+
+			std::mutex m_injection_mtx;
+			std::deque<pooled_call> m_injection;
+			std::atomic<std::size_t> m_nb_pending{ 0 };
+			std::atomic<std::uint64_t> m_nb_pushes{ 0 };
+			std::atomic<std::size_t> m_next_victim{ 0 };
+			std::shared_mutex m_workers_mtx;
+			std::vector<async_delegates*> m_workers;
+		};
+
+		// The signal queue of the current thread, registered by its first poll (or its first timer, eventfd or queued call to itself)
+		// and removed from the registry at its exit.
+		struct thread_queue_owner
+		{
+			// Registers the queue, a worker (a thread polling with sisl::poll()) also takes the pooled calls.
+			async_delegates& get(bool worker = true)
 			{
-				priv::gtl_current_sender = info.owner;
-				result = slot(args...);
-				priv::gtl_current_sender = nullptr;
+				if (!m_sp_delegates)
+					m_sp_delegates = hashmap_signal_queue::instance().register_thread(std::this_thread::get_id());
+				if (worker && !m_sp_delegates->m_is_worker)
+					work_pool::instance().add_worker(*m_sp_delegates);
+				return *m_sp_delegates;
 			}
-			// If the slot is single-shot, remove it after calling
-			if (!result || ((int)info.type & (int)type_connection::single_shot))
-				slots_to_remove.push_back(sp_slot);
-		}
 
-		if (!slots_to_remove.empty())
-		{
-			std::unique_lock lock(m_mtx);
-			for (const auto& sp_slot : slots_to_remove)
+			~thread_queue_owner()
 			{
-				std::erase_if(*m_slots, [&sp_slot](const std::shared_ptr<priv::slot<lvalue_reference_if_value_t<TARGS>...>>& slot)
+				if (m_sp_delegates)
 				{
-					return slot.get() == sp_slot.get();
-				});
+					if (m_sp_delegates->m_is_worker)
+						work_pool::instance().remove_worker(*m_sp_delegates);
+					hashmap_signal_queue::instance().remove(std::this_thread::get_id(), m_sp_delegates.get());
+				}
 			}
-		}
-	}
 
-	namespace priv
-	{
-		// MPSC (Multiple Producer Single Consumer) Lock-Free Queue
-		// Only ONE consumer thread is allowed to pop elements from the queue
-		template<typename T>
-		class MPSC_lock_free_queue
+			std::shared_ptr<async_delegates> m_sp_delegates;
+		};
+
+		// Direct access to the queue of the current thread (skips the registry's lock).
+		thread_local async_delegates* gtl_async_delegates = nullptr;
+		thread_local thread_queue_owner gtl_thread_queue_owner;
+
+#ifdef SISL_INSTRUMENTATION
+		// Counters of the running threads, and the sums of the exited ones.
+		struct statistics_registry
 		{
+			// Never destroyed: threads may exit during the static destruction.
+			static statistics_registry& instance()
+			{
+				static statistics_registry* instance = new statistics_registry();
+				return *instance;
+			}
+
+			void add(const thread_statistics& stats)
+			{
+				std::lock_guard lock(m_mtx);
+				m_threads.push_back(&stats);
+			}
+
+			void remove(const thread_statistics& stats)
+			{
+				std::lock_guard lock(m_mtx);
+				m_threads.erase(std::find(m_threads.begin(), m_threads.end(), &stats));
+				accumulate(stats, m_exited, m_exited_max_queue_latency_ns);
+			}
+
+			void sum(std::array<std::uint64_t, thread_statistics::nb_counters>& counters, std::uint64_t& max_queue_latency_ns)
+			{
+				std::lock_guard lock(m_mtx);
+				counters = m_exited;
+				max_queue_latency_ns = m_exited_max_queue_latency_ns;
+				for (const thread_statistics* p_stats : m_threads)
+					accumulate(*p_stats, counters, max_queue_latency_ns);
+			}
+
 		private:
-			struct alignas(std::hardware_constructive_interference_size) Node
+			static void accumulate(const thread_statistics& stats, std::array<std::uint64_t, thread_statistics::nb_counters>& counters, std::uint64_t& max_queue_latency_ns)
 			{
-				T data;
-				std::atomic<Node*> next;
-				Node(T value) : data(std::move(value)), next(nullptr) {}
+				for (std::size_t i = 0; i < thread_statistics::nb_counters; ++i)
+					counters[i] += stats.m_counters[i].load(std::memory_order_relaxed);
+				max_queue_latency_ns = std::max(max_queue_latency_ns, stats.m_max_queue_latency_ns.load(std::memory_order_relaxed));
+			}
+
+			std::mutex m_mtx;
+			std::vector<const thread_statistics*> m_threads;
+			std::array<std::uint64_t, thread_statistics::nb_counters> m_exited{};
+			std::uint64_t m_exited_max_queue_latency_ns = 0;
+		};
+
+		// The counters of the current thread, registered on its first instrumented operation.
+		struct thread_statistics_owner
+		{
+			thread_statistics_owner() { statistics_registry::instance().add(m_stats); }
+			~thread_statistics_owner() { statistics_registry::instance().remove(m_stats); }
+
+			thread_statistics m_stats;
+		};
+
+		thread_local thread_statistics_owner gtl_statistics_owner;
+
+		thread_statistics& local_statistics()
+		{
+			return gtl_statistics_owner.m_stats;
+		}
+
+		std::atomic<std::size_t> g_next_counter_stripe{ 0 };
+
+		std::size_t local_counter_stripe() noexcept
+		{
+			thread_local const std::size_t stripe = g_next_counter_stripe.fetch_add(1, std::memory_order_relaxed) % slot_list_base::nb_counter_stripes;
+			return stripe;
+		}
+#endif // SISL_INSTRUMENTATION
+
+#ifdef SISL_TRACING
+		// Ring buffer of the last trace events of a thread.
+		// Only written by its thread, each record is a seqlock so dump_trace() reads them from any thread without lock (torn records are skipped).
+		struct trace_buffer
+		{
+			static constexpr std::size_t capacity = SISL_TRACE_BUFFER_SIZE;
+			static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0, "SISL_TRACE_BUFFER_SIZE must be a power of two");
+			// The ring is allocated by segments, on the first event written in each: a thread tracing a few events doesn't pay for the whole ring.
+			static constexpr std::size_t segment_size = capacity < 256 ? capacity : 256;
+			static constexpr std::size_t nb_segments = capacity / segment_size;
+
+			// Flow ids are unique among the threads: the index of the thread in the high bits.
+			static constexpr std::size_t flow_id_thread_shift = 40;
+
+			struct event
+			{
+				std::uint64_t timestamp_ns;
+				std::uint64_t flow_id;
+				const void* signal;
+				const void* owner;
+				trace_event event;
+				type_connection type;
 			};
 
-			// cache line size alignment to avoid false sharing
-			alignas(std::hardware_constructive_interference_size) std::atomic<Node*> m_head;
-			alignas(std::hardware_constructive_interference_size) std::atomic<Node*> m_tail;
+			struct record
+			{
+				std::atomic<std::uint64_t> sequence{ 0 };	///< 2 * index + 1 while written, 2 * index + 2 once written.
+				std::atomic<std::uint64_t> timestamp_ns{ 0 };
+				std::atomic<std::uint64_t> flow_id{ 0 };
+				std::atomic<const void*> signal{ nullptr };
+				std::atomic<const void*> owner{ nullptr };
+				std::atomic<trace_event> event{ trace_event::emit_begin };
+				std::atomic<type_connection> type{ type_connection::automatic };
+			};
 
-		public:
-			MPSC_lock_free_queue()
+			trace_buffer(std::uint64_t thread_index, std::thread::id thread_id)
+				: m_thread_index(thread_index), m_thread_id(thread_id)
 			{
-				Node* dummy = new Node(T{});
-				m_head.store(dummy, std::memory_order_relaxed);
-				m_tail.store(dummy, std::memory_order_relaxed);
 			}
-			~MPSC_lock_free_queue()
+
+			~trace_buffer()
 			{
-				Node* current_node = m_head.load(std::memory_order_relaxed);
-				while (current_node)
-				{
-					Node* next_node = current_node->next.load(std::memory_order_relaxed);
-					delete current_node;
-					current_node = next_node;
-				}
+				for (auto& segment : m_segments)
+					delete[] segment.load(std::memory_order_relaxed);
 			}
-			bool push(T value)
+
+			trace_buffer(const trace_buffer&) = delete;
+			trace_buffer& operator=(const trace_buffer&) = delete;
+
+			void write(trace_event e, const void* signal, const void* owner, type_connection type, std::uint64_t flow_id) noexcept
 			{
-				Node* new_node = new Node(std::move(value));
-				while (true)
+				const std::uint64_t index = m_head.load(std::memory_order_relaxed);
+				const std::size_t slot = index & (capacity - 1);
+				std::atomic<record*>& segment = m_segments[slot / segment_size];
+				record* p_records = segment.load(std::memory_order_relaxed);
+				if (!p_records)
 				{
-					Node* old_tail = m_tail.load(std::memory_order_acquire);
-					Node* next_node = old_tail->next.load(std::memory_order_acquire);
-
-					if (next_node == nullptr)
-					{
-						if (old_tail->next.compare_exchange_weak(next_node, new_node, std::memory_order_release))
-						{
-							m_tail.compare_exchange_strong(old_tail, new_node, std::memory_order_release);
-							return true;
-						}
-					}
-					else
-					{
-						m_tail.compare_exchange_strong(old_tail, next_node, std::memory_order_release, std::memory_order_relaxed);
-					}
+					p_records = new (std::nothrow) record[segment_size];
+					if (!p_records)
+						return; // Out of memory: the event is not traced
+					segment.store(p_records, std::memory_order_release);
 				}
+				record& r = p_records[slot % segment_size];
+				r.sequence.store(2 * index + 1, std::memory_order_relaxed);
+				// Release stores: a reader that sees one of the new fields sees the odd sequence too (no fence, which ThreadSanitizer doesn't model)
+				r.timestamp_ns.store(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()), std::memory_order_release);
+				r.flow_id.store(flow_id, std::memory_order_release);
+				r.signal.store(signal, std::memory_order_release);
+				r.owner.store(owner, std::memory_order_release);
+				r.event.store(e, std::memory_order_release);
+				r.type.store(type, std::memory_order_release);
+				r.sequence.store(2 * index + 2, std::memory_order_release);
+				m_head.store(index + 1, std::memory_order_release);
 			}
 
-			bool pop(T& value) noexcept
+			void read(std::vector<event>& events) const
 			{
-				while (true)
+				const std::uint64_t head = m_head.load(std::memory_order_acquire);
+				for (std::uint64_t index = head > capacity ? head - capacity : 0; index < head; ++index)
 				{
-					Node* old_head = m_head.load(std::memory_order_acquire);
-					Node* next_node = old_head->next.load(std::memory_order_acquire);
-					if (next_node == nullptr)
-					{
-						return false;
-					}
-					if (m_head.compare_exchange_strong(old_head, next_node, std::memory_order_release))
-					{
-						value = std::move(next_node->data);
-						delete old_head;
-						return true;
-					}
+					const std::size_t slot = index & (capacity - 1);
+					const record* p_records = m_segments[slot / segment_size].load(std::memory_order_acquire);
+					if (!p_records)
+						continue;
+					const record& r = p_records[slot % segment_size];
+					const std::uint64_t sequence = r.sequence.load(std::memory_order_acquire);
+					if (sequence != 2 * index + 2)
+						continue; // Being overwritten
+					// Acquire loads: the sequence read after them is at least the one of the writer of the fields seen
+					const event copy{ r.timestamp_ns.load(std::memory_order_acquire), r.flow_id.load(std::memory_order_acquire),
+									  r.signal.load(std::memory_order_acquire), r.owner.load(std::memory_order_acquire),
+									  r.event.load(std::memory_order_acquire), r.type.load(std::memory_order_acquire) };
+					if (r.sequence.load(std::memory_order_relaxed) == sequence)
+						events.push_back(copy);
 				}
 			}
 
-			bool empty() const
-			{
-				Node* head = m_head.load(std::memory_order_acquire);
-				Node* next_node = head->next.load(std::memory_order_acquire);
-				return next_node == nullptr;
-			}
+			const std::uint64_t m_thread_index;
+			const std::thread::id m_thread_id;
+			std::uint64_t m_last_flow_id = 0;	///< Only used by the thread of the buffer.
+			std::atomic<std::uint64_t> m_head{ 0 };
+			std::array<std::atomic<record*>, nb_segments> m_segments{};	///< Only allocated by the thread of the buffer.
 		};
 
-		// BETA
-		// MPSC (Multiple Producer Single Consumer) Lock-Free Ring Queue
-		// Only ONE consumer thread is allowed to pop elements from the queue
-		// This is a fixed-size ring-queue, push will fail if the queue is full.
-		// Faster than MPSC_lock_free_queue because it uses a fixed-size array and no dynamic memory allocation.
-		template<typename T, std::size_t CAPACITY>
-		class MPSC_lock_free_ring_queue
+		// Trace buffers of the running threads, and of the last exited ones.
+		struct trace_registry
 		{
-		private:
-			struct alignas(std::hardware_constructive_interference_size) Node
+			static constexpr std::size_t max_exited_buffers = SISL_TRACE_MAX_EXITED_THREADS;
+
+			// Never destroyed: threads may exit during the static destruction.
+			static trace_registry& instance()
 			{
-				T data;
-				std::atomic<bool> is_valid;
-			};
-			alignas(std::hardware_constructive_interference_size) std::array<Node, CAPACITY> m_nodes;
-			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_head;
-			alignas(std::hardware_constructive_interference_size) std::atomic<std::size_t> m_tail;
+				static trace_registry* instance = new trace_registry();
+				return *instance;
+			}
 
-		public:
-			MPSC_lock_free_ring_queue()
+			std::shared_ptr<trace_buffer> add()
 			{
-				m_head.store(0, std::memory_order_relaxed);
-				m_tail.store(0, std::memory_order_relaxed);
-				for (auto& node : m_nodes)
-				{
-					node.is_valid.store(false, std::memory_order_relaxed);
-				}
+				std::lock_guard lock(m_mtx);
+				auto sp_buffer = std::make_shared<trace_buffer>(++m_last_thread_index, std::this_thread::get_id());
+				m_buffers.push_back(sp_buffer);
+				return sp_buffer;
 			}
-			bool push(T value)
+
+			// The events of an exited thread are kept (the buffers of the oldest exited threads are dropped).
+			void retire(const std::shared_ptr<trace_buffer>& sp_buffer)
 			{
-				size_t old_tail = 0;
-				size_t new_tail = 0;
-				do
-				{
-					old_tail = m_tail.load(std::memory_order_acquire);
-					new_tail = (old_tail + 1) % CAPACITY;
-					if (new_tail == m_head.load(std::memory_order_acquire))
-					{
-						return false; // Queue is full
-					}
-				} while (!m_tail.compare_exchange_weak(old_tail, new_tail, std::memory_order_release, std::memory_order_relaxed));
-				m_nodes[old_tail].data = std::move(value);
-				m_nodes[old_tail].is_valid.store(true, std::memory_order_release);
-				return true;
+				std::lock_guard lock(m_mtx);
+				m_buffers.erase(std::find(m_buffers.begin(), m_buffers.end(), sp_buffer));
+				m_exited_buffers.push_back(sp_buffer);
+				if (m_exited_buffers.size() > max_exited_buffers)
+					m_exited_buffers.pop_front();
 			}
-			bool pop(T& value) noexcept
+
+			// The buffers being dumped are freed once the dump is done
+			void clear_exited()
 			{
-				size_t old_head = m_head.load(std::memory_order_acquire);
-				if (old_head == m_tail.load(std::memory_order_acquire))
-				{
-					return false; // Queue is empty
-				}
-				if (!m_nodes[old_head].is_valid.load(std::memory_order_acquire))
+				std::deque<std::shared_ptr<trace_buffer>> exited_buffers;
+				std::lock_guard lock(m_mtx);
+				exited_buffers.swap(m_exited_buffers);
+			}
+
+			std::vector<std::shared_ptr<trace_buffer>> get_buffers()
+			{
+				std::lock_guard lock(m_mtx);
+				std::vector<std::shared_ptr<trace_buffer>> buffers(m_exited_buffers.begin(), m_exited_buffers.end());
+				buffers.insert(buffers.end(), m_buffers.begin(), m_buffers.end());
+				return buffers;
+			}
+
+		private:
+			std::mutex m_mtx;
+			std::uint64_t m_last_thread_index = 0;
+			std::vector<std::shared_ptr<trace_buffer>> m_buffers;
+			std::deque<std::shared_ptr<trace_buffer>> m_exited_buffers;
+		};
+
+		// The trace buffer of the current thread, created by its first event.
+		struct trace_buffer_owner
+		{
+			trace_buffer* get() noexcept
+			{
+				if (!m_sp_buffer)
 				{
-					return false; // The node is not valid, this can happen if the node was not pushed yet.
+					try
+					{
+						m_sp_buffer = trace_registry::instance().add();
+					}
+					catch (...)
+					{
+						return nullptr; // Out of memory: the events of the thread are not traced
+					}
 				}
-				value = std::move(m_nodes[old_head].data);
-				m_nodes[old_head].is_valid.store(false, std::memory_order_release);
-				m_head.store((old_head + 1) % CAPACITY, std::memory_order_release);
-				return true;
+				return m_sp_buffer.get();
 			}
-			bool empty() const
+
+			~trace_buffer_owner()
 			{
-				return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+				if (m_sp_buffer)
+					trace_registry::instance().retire(m_sp_buffer);
 			}
+
+			std::shared_ptr<trace_buffer> m_sp_buffer;
 		};
-	}
 
-	template<typename TSENDER>
-	TSENDER* sender() { return priv::gtl_current_sender ? static_cast<TSENDER*>(priv::gtl_current_sender) : nullptr; }
-}
-// <=====================================================================================>
-// <=============				  Statics implementation					=============>
-// <=====================================================================================>
+		thread_local trace_buffer_owner gtl_trace_buffer_owner;
 
-#ifdef SISL_IMPLEMENTATION
+		void trace(trace_event event, const void* signal, const void* owner, type_connection type, std::uint64_t flow_id) noexcept
+		{
+			if (trace_buffer* p_buffer = gtl_trace_buffer_owner.get())
+				p_buffer->write(event, signal, owner, type, flow_id);
+		}
 
-#include <condition_variable>
-#include <mutex>
-#include <optional>
+		std::uint64_t next_trace_flow_id() noexcept
+		{
+			trace_buffer* p_buffer = gtl_trace_buffer_owner.get();
+			if (!p_buffer)
+				return 0;
+			return (p_buffer->m_thread_index << trace_buffer::flow_id_thread_shift) | ++p_buffer->m_last_flow_id;
+		}
+#endif // SISL_TRACING
 
-namespace SISL_NAMESPACE
-{
-	namespace priv
-	{
-		// The thread-local current sender.
-		thread_local void* gtl_current_sender = nullptr;
+		void forget_thread_queue(std::thread::id thread_id)
+		{
+			hashmap_signal_queue::instance().remove(thread_id, nullptr);
+		}
 
-#ifdef SISL_USE_LOCK_FREE_RING_QUEUE
-		using lock_free_queue = MPSC_lock_free_ring_queue<std::function<void()>, SISL_MAX_SLOTS_LOCK_FREE_RING_QUEUE>; // Example capacity, can be adjusted
-#else
-		using lock_free_queue = MPSC_lock_free_queue<std::function<void()>>; // Default lock-free queue
-#endif
-		// A thread-safe queue for signals.
-		struct async_delegates
+		void enqueue(queued_call&& call, std::thread::id thread_id, bool idle)
 		{
-			lock_free_queue m_queue;
-			std::mutex m_mtx_cv;
-			std::condition_variable m_cv;
-			std::atomic_bool m_terminated;
-		};
+			// The queue of the current thread is registered (removed at its exit), the one of another thread may be pending until its first poll
+			std::shared_ptr<async_delegates> sp_delegates;
+			async_delegates& delegates = thread_id == std::this_thread::get_id() ? gtl_thread_queue_owner.get(false)
+				: *(sp_delegates = hashmap_signal_queue::instance().get_thread_queue(thread_id));
+			const bool pushed = delegates.push(std::move(call), idle);
+			delegates.wake_up();
+			if (!pushed)
+				throw queue_full();
+		}
 
-		// The thread-local async_delegates instance (signal queue) for each thread.
-		// Can be accessed via hashmap_signal_queue::instance().get_thread_queue(thread_id) from any thread.
-		// And directly via the current thread (and so skips the read lock of the hashmap_signal_queue).
-		thread_local async_delegates* gtl_async_delegates = nullptr;
+		void schedule_timer(std::shared_ptr<timer_state> sp_timer, std::chrono::steady_clock::duration delay)
+		{
+			const auto deadline = std::chrono::steady_clock::now() + delay;
+			if (gtl_polled_queue)
+			{
+				gtl_polled_queue->add_timer(std::move(sp_timer), deadline);
+				return;
+			}
+			// Registers the queue of the thread (removed at its exit), without enrolling the thread in the work pool
+			gtl_thread_queue_owner.get(false).add_timer(std::move(sp_timer), deadline);
+		}
 
-		// A thread-safe map of signal queues, indexed by thread ID.
-		// Singleton pattern to ensure only one instance exists.
-		struct hashmap_signal_queue
+		bool enqueue(queued_call&& call, async_delegates& loop, bool idle)
 		{
-			static hashmap_signal_queue& instance()
+			// Either terminate() waits for this push, or this thread sees the loop terminated (both seq_cst):
+			// once terminate() returned, no call is pushed anymore and the loop's destructor drops the pushed ones.
+			loop.m_nb_pushing.fetch_add(1, std::memory_order_seq_cst);
+			if (loop.m_terminated.load(std::memory_order_seq_cst))
 			{
-				static hashmap_signal_queue instance;
-				return instance;
+				loop.m_nb_pushing.fetch_sub(1, std::memory_order_release);
+				return false;
 			}
+			const bool pushed = loop.push(std::move(call), idle);
+			loop.m_nb_pushing.fetch_sub(1, std::memory_order_release);
+			loop.wake_up();
+			if (!pushed)
+				throw queue_full();
+			return true;
+		}
+
+#ifdef SISL_NUMA_AWARE
+		int numa_node_of(std::thread::id thread_id)
+		{
+			const std::shared_ptr<async_delegates> sp_delegates = hashmap_signal_queue::instance().find_thread_queue(thread_id);
+			return sp_delegates ? sp_delegates->m_queue.get_numa_node() : -1;
+		}
+
+		int numa_node_of(const async_delegates& delegates) noexcept
+		{
+			return delegates.m_queue.get_numa_node();
+		}
+#endif // SISL_NUMA_AWARE
+
+		void enqueue_pooled(queued_call&& call)
+		{
+			// The calls emitted by a worker land in its own deque (the other workers steal them when they are idle)
+			work_pool::instance().push(std::move(call), gtl_async_delegates);
+		}
+
+		// Invokes a queued call, p_queue is the queue it was posted to (nullptr for the pooled calls).
+		void invoke(queued_call& call, [[maybe_unused]] async_delegates* p_queue)
+		{
+#ifdef SISL_INSTRUMENTATION
+			const auto latency = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stats_clock::now() - call.enqueued_at).count());
+			local_statistics().add_queued_invocation(latency);
+			if (p_queue)
+				p_queue->m_latency.record(latency);
+#endif // SISL_INSTRUMENTATION
+#ifdef SISL_TRACING
+			// The dequeue event is the end of the flow started by the enqueue, it binds to the slot slice that follows it
+			trace(trace_event::dequeue, call.trace.signal, call.trace.owner, call.trace.type, call.trace.flow_id);
+			const trace_scope trace_slot(trace_event::slot_begin, call.trace.signal, call.trace.owner, call.trace.type);
+#endif // SISL_TRACING
+			call.delegate();
+		}
 
-			async_delegates& get_thread_queue(std::thread::id thread_id)
+		// Invokes the pending delegates of a queue (of a thread or an event loop) in the current thread.
+		// The threads polling with sisl::poll() also invoke the pooled calls when their own queue is empty.
+		polling_result poll_queue(async_delegates& delegates, std::chrono::milliseconds timeout)
+		{
+			// A queue has a single consumer: only the thread polling it may poll it again (from one of its slots)
+			const std::thread::id current_thread = std::this_thread::get_id();
+			std::thread::id polling_thread;
+			const bool is_nested = delegates.m_polling_thread.load(std::memory_order_relaxed) == current_thread;
+			if (!is_nested && !delegates.m_polling_thread.compare_exchange_strong(polling_thread, current_thread, std::memory_order_acquire))
+				throw invalid_concurrent_polling();
+			struct polling_scope
 			{
-				std::shared_lock<std::shared_mutex> read_lock(m_mutex);
-				auto it = m_async_delegates.find(thread_id);
-				if (it != m_async_delegates.end())
-				{
-					return *it->second;
-				}
-				read_lock.unlock();
-				std::unique_lock<std::shared_mutex> write_lock(m_mutex);
-				it = m_async_delegates.find(thread_id);
-				if (it != m_async_delegates.end())
+				async_delegates& delegates;
+				async_delegates* p_previous_queue;
+				bool is_nested;
+				~polling_scope()
 				{
-					return *it->second;
+					gtl_polled_queue = p_previous_queue;
+					if (!is_nested)
+						delegates.m_polling_thread.store(std::thread::id(), std::memory_order_release);
 				}
-				auto [new_it, _] = m_async_delegates.emplace(thread_id, std::make_unique<async_delegates>());
-				return *new_it->second;
-			}
+			} scope{ delegates, gtl_polled_queue, is_nested };
+			gtl_polled_queue = &delegates;
+#ifdef SISL_NUMA_AWARE
+			// The consumer may have migrated (or the loop moved to another thread): the next calls follow it
+			delegates.m_queue.set_numa_node(current_numa_node());
+			delegates.m_idle_queue.set_numa_node(current_numa_node());
+#endif
 
-			void terminates(std::thread::id id)
+			auto& cv = delegates.m_cv;
+			auto& mtx_cv = delegates.m_mtx_cv;
+			auto& queue = delegates.m_queue;
+			work_pool* p_pool = delegates.m_is_worker ? &work_pool::instance() : nullptr;
+			// The pooled calls left after a failed take were all emitted by this thread: the wait ignores them until the next push
+			std::uint64_t nb_pushes_seen = std::numeric_limits<std::uint64_t>::max();
+			auto ready = [&delegates, p_pool, &nb_pushes_seen]
 			{
-				std::shared_lock<std::shared_mutex> read_lock(m_mutex);
-				if (id == std::thread::id())
+				// The emptiness checks are seq_cst loads, ordered after the seq_cst store of m_waiting (see async_delegates::wake_up())
+				return delegates.m_terminated.load(std::memory_order_acquire) || !delegates.m_queue.empty() || !delegates.m_idle_queue.empty() || (p_pool && p_pool->has_work(nb_pushes_seen));
+			};
+			// The wait ends at the timeout, or earlier at the deadline of the nearest timer
+			const auto end = timeout == blocking_polling ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + timeout;
+			while (true)
+			{
+				if(delegates.m_terminated.load(std::memory_order_acquire))
+				{
+					return polling_result::terminated; // If SISL is terminated, we return immediately.
+				}
+				bool invoked = delegates.fire_timers();
+				if (timeout.count() > 0 && !invoked)
 				{
-					for (const auto& [thread_id, delegates] : m_async_delegates)
+					const auto wake_up_at = std::min(end, delegates.next_deadline());
 					{
-						delegates->m_terminated.store(true, std::memory_order_release);
-						delegates->m_cv.notify_all();
+						std::unique_lock<std::mutex> lock(mtx_cv);
+						delegates.m_waiting.store(true, std::memory_order_seq_cst);
+						if (wake_up_at == std::chrono::steady_clock::time_point::max())
+							cv.wait(lock, ready);
+						else
+							cv.wait_until(lock, wake_up_at, ready);
+						delegates.m_waiting.store(false, std::memory_order_relaxed);
 					}
+					invoked = delegates.fire_timers();
 				}
-				else
+#ifdef __linux__
+				delegates.reset_event_fd();
+#endif // __linux__
+				while (true)
 				{
-					auto it = m_async_delegates.find(id);
-					if (it != m_async_delegates.end())
+					if (delegates.m_terminated.load(std::memory_order_acquire))
+						return polling_result::terminated;
+					queued_call call;
+					const std::uint64_t nb_pushes = p_pool ? p_pool->get_nb_pushes() : 0;
+					if (!queue.empty())
+					{
+						if (delegates.pop(call))
+						{
+							invoke(call, &delegates);
+							invoked = true;
+						}
+					}
+					else if (p_pool && p_pool->take(delegates, call))
+					{
+						invoke(call, nullptr);
+						invoked = true;
+					}
+					else if (!delegates.m_idle_queue.empty() && delegates.pop(call, true))
 					{
-						it->second.get()->m_terminated.store(true, std::memory_order_release);
-						it->second.get()->m_cv.notify_all();
+						// One idle call at a time: the normal calls enqueued meanwhile are invoked first
+						invoke(call, &delegates);
+						invoked = true;
+					}
+					else
+					{
+						if (p_pool)
+							nb_pushes_seen = nb_pushes;
+						break;
 					}
 				}
+				if (invoked)
+					return polling_result::slots_invoked;
+				// Another worker may have taken the pooled call that woke us up (or the timer was cancelled): wait again until the end
+				if (timeout.count() <= 0 || std::chrono::steady_clock::now() >= end)
+					return polling_result::timeout;
 			}
-
-			std::unordered_map<std::thread::id, std::unique_ptr<async_delegates>> m_async_delegates;
-			std::shared_mutex m_mutex;
-		};
-
-		void enqueue(std::function<void()>&& delegate, std::thread::id thread_id)
-		{
-			auto& delegates = hashmap_signal_queue::instance().get_thread_queue(thread_id);
-			const bool pushed = delegates.m_queue.push(std::move(delegate));
-			delegates.m_cv.notify_one();
-			if (!pushed)
-				throw queue_full();
 		}
 	}
 
@@ -1427,43 +5631,226 @@ namespace SISL_NAMESPACE
 		if(priv::gtl_async_delegates == nullptr)
 		{
 			// If the thread-local async_delegates is not initialized, we initialize it.
-			priv::gtl_async_delegates = &priv::hashmap_signal_queue::instance().get_thread_queue(std::this_thread::get_id());
+			priv::gtl_async_delegates = &priv::gtl_thread_queue_owner.get();
 		}
-		auto& cv = priv::gtl_async_delegates->m_cv;
-		auto& mtx_cv = priv::gtl_async_delegates->m_mtx_cv;
-		auto& queue = priv::gtl_async_delegates->m_queue;
-		if(priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire))
+		return priv::poll_queue(*priv::gtl_async_delegates, timeout);
+	}
+
+	std::chrono::milliseconds next_timer_delay()
+	{
+		if (priv::gtl_async_delegates)
+			return priv::gtl_async_delegates->next_timer_delay();
+		// A thread without a registered queue has no timer (schedule_timer() registers it)
+		if (priv::gtl_thread_queue_owner.m_sp_delegates)
+			return priv::gtl_thread_queue_owner.m_sp_delegates->next_timer_delay();
+		return blocking_polling;
+	}
+
+#ifdef __linux__
+	int event_fd()
+	{
+		// The queue is registered (removed at the thread's exit) without enrolling the thread in the work pool: only poll() does
+		if (priv::gtl_async_delegates)
+			return priv::gtl_async_delegates->get_event_fd();
+		return priv::gtl_thread_queue_owner.get(false).get_event_fd();
+	}
+#endif // __linux__
+
+#ifdef SISL_TRACING
+	void dump_trace(std::ostream& stream)
+	{
+		using priv::trace_event;
+		const auto write_pointer = [&stream](const void* p)
 		{
-			return polling_result::terminated; // If SISL is terminated, we return immediately.
-		}
-		std::unique_lock<std::mutex> lock(mtx_cv);
-		if (timeout == blocking_polling)
+			stream << "\"0x" << std::hex << reinterpret_cast<std::uintptr_t>(p) << std::dec << '"';
+		};
+		const auto type_name = [](type_connection type)
 		{
-			cv.wait(lock, [&queue] { return priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire) || !queue.empty(); });
-		}
-		else if (timeout.count() > 0)
+			switch (get_type_connection_without_flags(type))
+			{
+			case type_connection::direct: return "direct";
+			case type_connection::queued: return "queued";
+			case type_connection::blocking_queued: return "blocking_queued";
+			case type_connection::pooled: return "pooled";
+			case type_connection::idle: return "idle";
+			default: return "automatic";
+			}
+		};
+
+		stream << "{\"traceEvents\":[";
+		bool first = true;
+		std::vector<priv::trace_buffer::event> events;
+		for (const auto& sp_buffer : priv::trace_registry::instance().get_buffers())
 		{
-			cv.wait_for(lock, timeout, [&queue] { return priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire) || !queue.empty(); });
+			stream << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << sp_buffer->m_thread_index
+				   << ",\"args\":{\"name\":\"thread " << sp_buffer->m_thread_id << "\"}}";
+			first = false;
+			events.clear();
+			sp_buffer->read(events);
+			for (const auto& event : events)
+			{
+				const char* name = "emit";
+				const char* phase = "B";
+				switch (event.event)
+				{
+				case trace_event::emit_begin: break;
+				case trace_event::emit_end: phase = "E"; break;
+				case trace_event::enqueue: name = "enqueue"; phase = "s"; break;
+				case trace_event::dequeue: name = "enqueue"; phase = "f"; break; // Flow events are matched by name and id
+				case trace_event::slot_begin: name = "slot"; break;
+				case trace_event::slot_end: name = "slot"; phase = "E"; break;
+				}
+				stream << ",\n{\"name\":\"" << name << "\",\"cat\":\"sisl\",\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << sp_buffer->m_thread_index
+					   << ",\"ts\":" << event.timestamp_ns / 1000 << '.' << (event.timestamp_ns % 1000) / 100 << (event.timestamp_ns % 100) / 10 << event.timestamp_ns % 10;
+				if (event.flow_id != 0)
+					stream << ",\"id\":" << event.flow_id;
+				if (event.event != trace_event::emit_end && event.event != trace_event::slot_end)
+				{
+					stream << ",\"args\":{\"signal\":";
+					write_pointer(event.signal);
+					if (event.event != trace_event::emit_begin)
+					{
+						stream << ",\"sender\":";
+						write_pointer(event.owner);
+						stream << ",\"type\":\"" << type_name(event.type) << '"';
+					}
+					stream << '}';
+				}
+				stream << '}';
+			}
 		}
-		if(queue.empty())
+		stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+	}
+
+	void dump_trace(const std::string& file_path)
+	{
+		std::ofstream file(file_path);
+		if (!file)
+			throw std::runtime_error("Cannot open the trace file " + file_path);
+		dump_trace(file);
+		if (!file)
+			throw std::runtime_error("Cannot write the trace file " + file_path);
+	}
+
+	void clear_exited_traces()
+	{
+		priv::trace_registry::instance().clear_exited();
+	}
+#endif // SISL_TRACING
+
+#ifdef SISL_INSTRUMENTATION
+	std::uint64_t latency_histogram::count() const noexcept
+	{
+		std::uint64_t count = 0;
+		for (const std::uint64_t bucket : buckets)
+			count += bucket;
+		return count;
+	}
+
+	std::uint64_t latency_histogram::value_at_percentile(double percentile) const noexcept
+	{
+		const std::uint64_t total = count();
+		if (total == 0)
+			return 0;
+		// Rank of the delay at the percentile (at least the first one)
+		const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(total))));
+		std::uint64_t seen = 0;
+		for (std::size_t i = 0; i < nb_buckets; ++i)
 		{
-			return priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire) ? polling_result::terminated : polling_result::timeout;
+			seen += buckets[i];
+			if (seen >= rank)
+				return upper_bound(i);
 		}
-		while (!queue.empty())
+		return upper_bound(nb_buckets - 1);
+	}
+
+	statistics get_statistics()
+	{
+		using counter = priv::thread_statistics::counter;
+		std::array<std::uint64_t, counter::nb_counters> counters;
+		statistics result;
+		priv::statistics_registry::instance().sum(counters, result.max_queue_latency_ns);
+		result.emits = counters[counter::emits];
+		result.direct_invocations = counters[counter::direct_invocations];
+		result.queued_posts = counters[counter::queued_posts];
+		result.queued_invocations = counters[counter::queued_invocations];
+		result.queue_latency_ns = counters[counter::queue_latency_ns];
+		result.blocking_waits = counters[counter::blocking_waits];
+		result.blocking_wait_ns = counters[counter::blocking_wait_ns];
+		result.queue_full = counters[counter::queue_full];
+		result.pooled_depth = priv::work_pool::instance().get_nb_pending();
+		for (auto& shard : priv::hashmap_signal_queue::instance().m_shards)
 		{
-			if (priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire))
-				return polling_result::terminated;
-			std::function<void()> delegate;
-			if (queue.pop(delegate))
-				delegate();
+			std::shared_lock<std::shared_mutex> read_lock(shard.m_mutex);
+			for (const auto& [thread_id, sp_delegates] : shard.m_async_delegates)
+				result.thread_queues.push_back({ thread_id, sp_delegates->get_depth(), sp_delegates->m_latency.read() });
 		}
-		return priv::gtl_async_delegates->m_terminated.load(std::memory_order_acquire) ? polling_result::terminated : polling_result::slots_invoked;
+		return result;
+	}
+#endif // SISL_INSTRUMENTATION
+
+	event_loop::event_loop()
+		: m_sp_delegates(std::make_shared<priv::async_delegates>())
+	{
+		// The thread polling the loop also takes the pooled calls
+		priv::work_pool::instance().add_worker(*m_sp_delegates);
+	}
+
+	event_loop::~event_loop()
+	{
+		priv::work_pool::instance().remove_worker(*m_sp_delegates);
+		terminate();
+		// Releases the pending calls now (their arguments, and the emitters waiting on blocking_queued calls)
+		priv::queued_call call;
+		while (m_sp_delegates->pop(call))
+			call.delegate = nullptr;
+		while (m_sp_delegates->pop(call, true))
+			call.delegate = nullptr;
+		m_sp_delegates->m_timers.clear();
+	}
+
+	polling_result event_loop::poll(std::chrono::milliseconds timeout)
+	{
+		return priv::poll_queue(*m_sp_delegates, timeout);
+	}
+
+	void event_loop::terminate()
+	{
+		m_sp_delegates->terminate();
+	}
+
+	std::chrono::milliseconds event_loop::next_timer_delay()
+	{
+		return m_sp_delegates->next_timer_delay();
+	}
+
+#ifdef __linux__
+	int event_loop::event_fd()
+	{
+		return m_sp_delegates->get_event_fd();
+	}
+#endif // __linux__
+
+#ifdef SISL_INSTRUMENTATION
+	latency_histogram event_loop::get_queue_latency() const
+	{
+		return m_sp_delegates->m_latency.read();
 	}
+#endif // SISL_INSTRUMENTATION
 
 	void terminate(std::thread::id id)
 	{
 		priv::hashmap_signal_queue::instance().terminates(id);
 	}
+
+	void set_slow_slot_handler(std::chrono::nanoseconds threshold, std::function<void(const slow_slot_report&)> handler)
+	{
+		priv::slow_slot_detector& detector = priv::slow_slot_detector::instance();
+		std::lock_guard lock(detector.m_mtx);
+		const bool enabled = handler && threshold.count() > 0;
+		detector.m_sp_handler = enabled ? std::make_shared<const std::function<void(const slow_slot_report&)>>(std::move(handler)) : nullptr;
+		priv::g_slow_slot_threshold_ns.store(enabled ? threshold.count() : 0, std::memory_order_relaxed);
+	}
 }
 
 #endif //SISL_IMPLEMENTATION